@@ -0,0 +1,41 @@
+// ------------------------------------------------- AlsoCommand.cpp --------------------------------------------------
+// Prints the co-borrow neighbors of one title tracked by CoBorrowTracker.
+
+#include "AlsoCommand.h"
+#include "Inventory.h"
+#include "Output.h"
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+void AlsoCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    const Movie *movie = inventory.findMovie(category, key);
+    if (!movie)
+    {
+        Output::err() << "ERROR: Also: unknown movie " << category << " '" << key << "'" << std::endl;
+        return;
+    }
+
+    const std::vector<CoBorrowTracker::Neighbor> neighbors =
+        inventory.getCoBorrows().neighbors(movie, CoBorrowTracker::NEIGHBORS, inventory.getCommandSeq());
+
+    Output::out() << "Also borrowed with " << category << " '" << key << "':" << std::endl;
+    if (neighbors.empty())
+    {
+        Output::out() << "  (no co-borrows)" << std::endl;
+        return;
+    }
+    for (const auto &n : neighbors)
+    {
+        Output::out() << "  " << std::fixed << std::setprecision(2) << n.weight << std::defaultfloat << " | ";
+        n.movie->display();
+    }
+}
+
+CommandRefs AlsoCommand::references() const
+{
+    CommandRefs refs;
+    refs.titles.push_back({category, key});
+    return refs;
+}
@@ -0,0 +1,41 @@
+// -------------------------------------------------- AlsoCommand.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: "Customers who borrowed this also borrowed" command: lists the titles most often borrowed together with
+//          one title, from the inventory's co-borrow tracker. Line format: "A D <type> <descriptor...>" (the
+//          descriptor as in a borrow line).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef ALSOCOMMAND_H
+#define ALSOCOMMAND_H
+
+#include "Command.h"
+#include <string>
+
+class AlsoCommand : public Command
+{
+public:
+    AlsoCommand(char category, const std::string &key)
+        : category(category),
+          key(key)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "Also borrowed with <type> '<key>':" then one line per neighbor (decayed weight and the movie's
+    //       current listing, heaviest first) or "  (no co-borrows)"; an unknown title is reported on stderr.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+    // Post: The title (for read-only validation).
+    CommandRefs references() const override;
+
+private:
+    char        category;
+    std::string key;
+};
+
+#endif // ALSOCOMMAND_H
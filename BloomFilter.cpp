@@ -0,0 +1,134 @@
+// ------------------------------------------------- BloomFilter.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Blocked Bloom filter sizing, probing and statistics (see BloomFilter.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "BloomFilter.h"
+
+#include <algorithm>    // std::min, std::max
+#include <cmath>        // std::log, std::ceil
+#include <functional>   // std::hash<std::string_view>
+
+static std::atomic<double> DEFAULT_RATE{0.01};
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// splitmix64 finalizer: spreads consecutive ids and weak string hashes over all 64 bits.
+static inline uint64_t mix(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// --------------------------------------------------- BloomFilter ----------------------------------------------------
+BloomFilter::BloomFilter(size_t capacity, double rate)
+    : blockCount(0),
+      capacity(0),
+      items(0),
+      hashes(1),
+      rate(rate > 0.0 ? std::min(std::max(rate, 1e-6), 0.5) : getDefaultRate())
+{
+    reset(capacity);
+}
+
+// ----------------------------------------------------- hashing ------------------------------------------------------
+uint64_t BloomFilter::hash(uint64_t value)
+{
+    return mix(value);
+}
+
+uint64_t BloomFilter::hash(std::string_view value)
+{
+    return mix(std::hash<std::string_view>()(value));
+}
+
+// ------------------------------------------------------ add ---------------------------------------------------------
+void BloomFilter::add(uint64_t h)
+{
+    // High 32 bits pick the block (multiply-shift range reduction); the low 32 and a
+    // multiplicative remix drive double hashing inside it.
+    uint64_t *block = &blocks[((h >> 32) * blockCount >> 32) * WORDS_PER_BLOCK];
+    const uint32_t a = static_cast<uint32_t>(h);
+    const uint32_t b = static_cast<uint32_t>((h * 0x9E3779B97F4A7C15ull) >> 32) | 1u;
+    for (int i = 0; i < hashes; ++i)
+    {
+        const uint32_t bit = (a + static_cast<uint32_t>(i) * b) & 511u;
+        block[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+    ++items;
+}
+
+// --------------------------------------------------- mayContain -----------------------------------------------------
+bool BloomFilter::mayContain(uint64_t h) const
+{
+    probes.fetch_add(1, std::memory_order_relaxed);
+    const uint64_t *block = &blocks[((h >> 32) * blockCount >> 32) * WORDS_PER_BLOCK];
+    const uint32_t a = static_cast<uint32_t>(h);
+    const uint32_t b = static_cast<uint32_t>((h * 0x9E3779B97F4A7C15ull) >> 32) | 1u;
+    for (int i = 0; i < hashes; ++i)
+    {
+        const uint32_t bit = (a + static_cast<uint32_t>(i) * b) & 511u;
+        if (!(block[bit >> 6] & (uint64_t(1) << (bit & 63))))
+        {
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    return true;
+}
+
+void BloomFilter::noteFalsePositive() const
+{
+    falsePositives.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------- growth -------------------------------------------------------
+bool BloomFilter::needsGrowth() const
+{
+    return items > capacity;
+}
+
+void BloomFilter::reset(size_t newCapacity)
+{
+    // Classic sizing: m/n = -ln(p) / ln(2)^2 bits per item, k = (m/n) ln 2. Blocking concentrates bits, so add
+    // one bit per item to stay near the target rate.
+    const double ln2        = std::log(2.0);
+    const double bitsPerKey = -std::log(rate) / (ln2 * ln2) + 1.0;
+
+    capacity   = std::max(newCapacity, MIN_CAPACITY);
+    blockCount = static_cast<size_t>(std::ceil(capacity * bitsPerKey / (WORDS_PER_BLOCK * 64.0)));
+    hashes     = std::min(16, std::max(1, static_cast<int>(bitsPerKey * ln2 + 0.5)));
+    items      = 0;
+    blocks.assign(blockCount * WORDS_PER_BLOCK, 0);
+}
+
+// --------------------------------------------------- statistics -----------------------------------------------------
+BloomFilter::Stats BloomFilter::getStats() const
+{
+    Stats s;
+    s.items          = items;
+    s.capacity       = capacity;
+    s.bits           = blockCount * WORDS_PER_BLOCK * 64;
+    s.hashes         = hashes;
+    s.rate           = rate;
+    s.probes         = probes.load(std::memory_order_relaxed);
+    s.rejected       = rejected.load(std::memory_order_relaxed);
+    s.passed         = s.probes - s.rejected;
+    s.falsePositives = falsePositives.load(std::memory_order_relaxed);
+    return s;
+}
+
+// -------------------------------------------------- default rate ----------------------------------------------------
+void BloomFilter::setDefaultRate(double rate)
+{
+    DEFAULT_RATE.store(std::min(std::max(rate, 1e-6), 0.5), std::memory_order_relaxed);
+}
+
+double BloomFilter::getDefaultRate()
+{
+    return DEFAULT_RATE.load(std::memory_order_relaxed);
+}
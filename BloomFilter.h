@@ -0,0 +1,90 @@
+// -------------------------------------------------- BloomFilter.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Blocked Bloom filter for fast rejection of lookups that cannot succeed (unknown customer IDs, unknown
+//          movie keys). All k bits of an item live in one 64-byte block, so a probe costs one cache line.
+// Notes  : - Sized from a capacity and a target false-positive rate (default 1%, changeable process-wide through
+//            setDefaultRate before filters are created). Owners call needsGrowth() after add() and re-add their
+//            items after reset(capacity * 2), so the rate holds as the set grows.
+//          - Probe statistics are relaxed atomics: probes, definite rejections, passes, and false positives
+//            (passes the owner found absent, reported through noteFalsePositive()).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <atomic>
+#include <cstddef>       // size_t
+#include <cstdint>       // uint64_t blocks and hashes
+#include <string_view>
+#include <vector>
+
+class BloomFilter
+{
+public:
+    static constexpr size_t MIN_CAPACITY = 64;
+
+    // Description: Empty filter for 'capacity' items at false-positive rate 'rate' (0 = getDefaultRate()).
+    explicit BloomFilter(size_t capacity = MIN_CAPACITY, double rate = 0.0);
+
+    BloomFilter(const BloomFilter&)            = delete;
+    BloomFilter& operator=(const BloomFilter&) = delete;
+
+    // ---------------------------------------------------- hashing ---------------------------------------------------
+    static uint64_t hash(uint64_t value);
+    static uint64_t hash(std::string_view value);
+
+    // ----------------------------------------------------- add ------------------------------------------------------
+    void add(uint64_t h);
+
+    // -------------------------------------------------- mayContain --------------------------------------------------
+    // Description: false = definitely absent; true = possibly present (check the real structure).
+    bool mayContain(uint64_t h) const;
+
+    // Description: The owner's real lookup missed after mayContain() returned true.
+    void noteFalsePositive() const;
+
+    // ------------------------------------------------- growth -------------------------------------------------------
+    // Description: True once more items were added than the filter was sized for.
+    bool needsGrowth() const;
+
+    // Description: Clear all bits and resize for 'capacity' items at the same rate; statistics are kept.
+    void reset(size_t capacity);
+
+    // ------------------------------------------------ statistics ----------------------------------------------------
+    struct Stats
+    {
+        size_t   items;
+        size_t   capacity;
+        size_t   bits;
+        int      hashes;
+        double   rate;
+        uint64_t probes;
+        uint64_t rejected;
+        uint64_t passed;
+        uint64_t falsePositives;
+    };
+    Stats getStats() const;
+
+    // ------------------------------------------------ default rate --------------------------------------------------
+    static void   setDefaultRate(double rate);   // clamped to [1e-6, 0.5]
+    static double getDefaultRate();
+
+private:
+    static constexpr size_t WORDS_PER_BLOCK = 8;   // 8 x 64 bits = one cache line
+
+    std::vector<uint64_t> blocks;   // blockCount * WORDS_PER_BLOCK words
+    size_t                blockCount;
+    size_t                capacity;
+    size_t                items;
+    int                   hashes;
+    double                rate;
+
+    mutable std::atomic<uint64_t> probes{0};
+    mutable std::atomic<uint64_t> rejected{0};
+    mutable std::atomic<uint64_t> falsePositives{0};
+};
+
+#endif // BLOOMFILTER_H
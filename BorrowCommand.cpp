@@ -5,32 +5,27 @@
 #include "Inventory.h"
 #include "CustomerHashTable.h"
 #include "Customer.h"
+#include "MovieFactory.h"
+#include "Output.h"
 #include <iostream>
 #include <sstream>
+#include <vector>
 
-// --------------------------------------------------------------------------------------------------------------
-// keyFor
-// Description: Build the inventory key for a given category + fields, matching Movie::buildKey() semantics.
-// --------------------------------------------------------------------------------------------------------------
-static std::string keyFor(char type, const std::string &title, int year,
-                          const std::string &director, int month, const std::string &actor)
+// ----------------------------------------------- printSuggestions ---------------------------------------------------
+// Description: After a lookup miss, print up to three existing keys whose text is closest to the descriptor.
+// --------------------------------------------------------------------------------------------------------------------
+static void printSuggestions(const Inventory &inventory, const std::string &text)
 {
-    if (type == 'F')
-    {
-        std::ostringstream oss;
-        oss << title << "|" << year;
-        return oss.str();
-    }
-    if (type == 'D')
+    const std::vector<TrigramIndex::Match> matches = inventory.getTextIndex().search(text, 3, 0.35);
+    if (matches.empty()) return;
+
+    Output::err() << "  did you mean:";
+    for (size_t i = 0; i < matches.size(); ++i)
     {
-        return director + "|" + title;
+        Output::err() << (i ? ", " : " ") << matches[i].movie->getCategory()
+                      << " '" << matches[i].movie->buildKey() << "'";
     }
-    // Classics
-    std::ostringstream oss;
-    oss << year << "-";
-    if (month < 10) oss << "0";
-    oss << month << "|" << actor;
-    return oss.str();
+    Output::err() << std::endl;
 }
 
 BorrowCommand::BorrowCommand(int id, char category, const std::string &title,
@@ -61,21 +56,35 @@ void BorrowCommand::execute(Inventory &inventory, CustomerHashTable &customers)
     Customer *cust = customers.getCustomer(customerID);
     if (!cust)
     {
-        std::cerr << "ERROR: Unknown customer ID " << customerID << std::endl;
+        Output::err() << "ERROR: Unknown customer ID " << customerID << std::endl;
         return;
     }
 
-    const std::string key = keyFor(movieType, title, year, director, month, actor);
-    const bool ok = inventory.borrowMovie(movieType, key, year);
-    if (!ok)
+    const std::string key = MovieFactory::keyFor(movieType, title, year, director, month, actor);
+    Movie *movie = inventory.borrowMovie(movieType, key, customerID);
+    if (!movie)
     {
-        std::cerr << "ERROR: Borrow failed for customer " << customerID
-                  << " movieType " << movieType << " key '" << key << "'" << std::endl;
+        Output::err() << "ERROR: Borrow failed for customer " << customerID
+                      << " movieType " << movieType << " key '" << key << "'" << std::endl;
+        if (!inventory.findMovie(movieType, key))
+        {
+            printSuggestions(inventory, title + " " + director + " " + actor);
+        }
         return;
     }
 
-    cust->borrowMovie(key);
+    inventory.getPopularity().recordBorrow(movie, inventory.getCommandSeq());
+    inventory.getCoBorrows().recordBorrow(customerID, movie, inventory.getCommandSeq());
+    cust->borrowMovie(inventory.getKey(movie));
     std::ostringstream h;
     h << "Borrow " << movieType << " [" << key << "]";
     cust->addHistory(h.str());
-}
\ No newline at end of file
+}
+
+CommandRefs BorrowCommand::references() const
+{
+    CommandRefs refs;
+    refs.customerId = customerID;
+    refs.titles.push_back({movieType, MovieFactory::keyFor(movieType, title, year, director, month, actor)});
+    return refs;
+}
@@ -3,11 +3,11 @@
 // Creation Date: <2025-08-20>
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
-// Purpose: Command that borrows a movie for a given customer. Supports Comedy (F), Drama (D), Classics (C).
+// Purpose: Command that borrows a movie for a given customer. Supports every genre in MovieFactory's table.
 // Notes  : Uses canonical keys consistent with Inventory/Movie buildKey():
-//          - F: "Title|Year"
-//          - D: "Director|Title"
-//          - C: "YYYY-MM|First Last"
+//          - F/N: "Title|Year"
+//          - D/W: "Director|Title"
+//          - C  : "YYYY-MM|First Last"
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef BORROWCOMMAND_H
@@ -19,7 +19,7 @@
 class BorrowCommand : public Command
 {
 public:
-    // Non-Classics: Comedy/Drama constructor
+    // Non-Classics constructor (Comedy/Drama/Documentary/Foreign)
     BorrowCommand(int id, char category, const std::string &title,
                   int year, const std::string &director);
 
@@ -29,15 +29,22 @@ public:
     // --------------------------------------------------------------------------------------------------------------
     // execute
     // Post: If customer exists and stock is available, decrements stock, records transaction, and marks as borrowed.
-    //       Otherwise logs an error with the reason (unknown customer, unknown movie, out of stock, etc.).
+    //       Otherwise logs an error with the reason (unknown customer, unknown movie, out of stock, etc.); for an
+    //       unknown movie, also lists the closest existing keys from the inventory's trigram index.
     // --------------------------------------------------------------------------------------------------------------
     void execute(Inventory &inventory, CustomerHashTable &customers) const override;
 
+    // --------------------------------------------------------------------------------------------------------------
+    // references
+    // Post: The customer id and the canonical key of the title to borrow.
+    // --------------------------------------------------------------------------------------------------------------
+    CommandRefs references() const override;
+
 private:
     int         customerID;
-    char        movieType;   // 'F','D','C'
+    char        movieType;   // 'F','D','C','N','W'
 
-    // F/D fields
+    // F/D/N/W fields
     std::string title;
     int         year;
     std::string director;
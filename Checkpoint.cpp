@@ -0,0 +1,242 @@
+// -------------------------------------------------- Checkpoint.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Atomic checkpoint write, read and loan/history restore (see Checkpoint.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "Checkpoint.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "Output.h"
+
+#include <algorithm>   // std::reverse
+#include <cstdio>      // std::rename, std::remove
+#include <fstream>
+#include <iostream>    // std::endl
+#include <sstream>
+
+static const char *const MAGIC = "MOVIES_CHECKPOINT 5";
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// Reads "<tag> <count>" and the count lines that follow it.
+static bool readSection(std::istream &in, const std::string &tag, std::vector<std::string> &lines)
+{
+    std::string header, name;
+    size_t count = 0;
+    if (!std::getline(in, header)) return false;
+    std::istringstream hs(header);
+    if (!(hs >> name >> count) || name != tag) return false;
+
+    lines.clear();
+    lines.reserve(count);
+    std::string line;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!std::getline(in, line)) return false;
+        lines.push_back(line);
+    }
+    return true;
+}
+
+// ------------------------------------------------------ save --------------------------------------------------------
+bool Checkpoint::save(const std::string &path, const State &position, Inventory &inventory,
+                      CustomerHashTable &customers)
+{
+    // Catalog in movies-file format with total copies (shelf + checked out); loans are re-borrowed on restore.
+    // Slot order makes the restore assign every title its current slot, which the statistics are keyed by.
+    std::ostringstream catalog;
+    const int titles = inventory.getTitleCount();
+    {
+        Output::Redirect to(catalog, Output::err());
+        const InventorySnapshot snap = inventory.snapshot();
+        for (int slot = 0; slot < titles; ++slot)
+        {
+            const Movie *m = inventory.getMovieAtSlot(slot);
+            m->print(snap.stockOf(m) + inventory.getCheckedOut(m));
+        }
+    }
+
+    std::ostringstream loans, history;
+    size_t loanCount = 0, historyCount = 0;
+    for (int id : customers.getIds())
+    {
+        const Customer *cust = customers.getCustomer(id);
+        for (const auto &loan : inventory.getCustomerLoans(id))
+        {
+            const std::string key = loan.first->buildKey();
+            loans << id << " " << loan.first->getCategory() << " " << loan.second << " "
+                  << (cust->hasBorrowed(key) ? 1 : 0) << " " << key << "\n";
+            ++loanCount;
+        }
+
+        const Customer::HistorySnapshot hist = cust->historySnapshot();
+        std::vector<std::string_view> lines;
+        lines.reserve(hist.size());
+        for (const Customer::HistoryEntry *e = hist.newest(); e; e = e->prev.get()) lines.push_back(e->text);
+        std::reverse(lines.begin(), lines.end());
+        for (std::string_view text : lines)
+        {
+            history << id << " " << text << "\n";
+            ++historyCount;
+        }
+    }
+
+    std::ostringstream reloads;
+    const std::vector<std::pair<uint64_t, std::string>> pending = inventory.getPendingReloads();
+    for (const auto &reload : pending) reloads << reload.first << " " << reload.second << "\n";
+
+    const std::vector<std::string> popularity = inventory.getPopularity().saveState();
+    const std::vector<std::string> coBorrows  = inventory.getCoBorrows().saveState();
+
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        out << MAGIC << "\n"
+            << "position " << position.offset << " " << position.lineNo << " " << position.completedBytes << " "
+            << position.executed << " " << position.skipped << " " << position.commandSeq << "\n"
+            << "catalog " << titles << "\n" << catalog.str()
+            << "loans " << loanCount << "\n" << loans.str()
+            << "history " << historyCount << "\n" << history.str()
+            << "reloads " << pending.size() << "\n" << reloads.str()
+            << "popularity " << popularity.size() << "\n";
+        for (const std::string &line : popularity) out << line << "\n";
+        out << "coborrows " << coBorrows.size() << "\n";
+        for (const std::string &line : coBorrows) out << line << "\n";
+        out << "end\n";
+        out.flush();
+        if (!out)
+        {
+            Output::err() << "ERROR: cannot write checkpoint file: " << tmp << std::endl;
+            return false;
+        }
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0)
+    {
+        Output::err() << "ERROR: cannot replace checkpoint file: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------ read --------------------------------------------------------
+bool Checkpoint::read(const std::string &path, State &state)
+{
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::string magic, line, tag;
+    std::vector<std::string> catalog, loans, history, reloads;
+    bool ok = std::getline(in, magic) && magic == MAGIC && std::getline(in, line);
+    if (ok)
+    {
+        std::istringstream ps(line);
+        ok = (ps >> tag >> state.offset >> state.lineNo >> state.completedBytes
+                    >> state.executed >> state.skipped >> state.commandSeq) && tag == "position";
+    }
+    ok = ok && readSection(in, "catalog", catalog) && readSection(in, "loans", loans)
+            && readSection(in, "history", history) && readSection(in, "reloads", reloads)
+            && readSection(in, "popularity", state.popularity) && readSection(in, "coborrows", state.coBorrows)
+            && std::getline(in, line) && line == "end";
+    if (!ok)
+    {
+        Output::err() << "ERROR: malformed checkpoint file, ignoring: " << path << std::endl;
+        return false;
+    }
+
+    state.catalog.clear();
+    for (const std::string &l : catalog) state.catalog += l + "\n";
+
+    state.loans.clear();
+    for (const std::string &l : loans)
+    {
+        std::istringstream ls(l);
+        Loan loan;
+        int held = 0;
+        if (!(ls >> loan.customerId >> loan.category >> loan.copies >> held)
+            || !std::getline(ls >> std::ws, loan.key))
+        {
+            Output::err() << "ERROR: malformed checkpoint loan, ignoring: " << l << std::endl;
+            continue;
+        }
+        loan.held = held != 0;
+        state.loans.push_back(loan);
+    }
+
+    state.history.clear();
+    for (const std::string &l : history)
+    {
+        std::istringstream hs(l);
+        int id = 0;
+        std::string text;
+        if (!(hs >> id) || !std::getline(hs.ignore(1), text)) continue;
+        state.history.emplace_back(id, text);
+    }
+
+    state.reloads.clear();
+    for (const std::string &l : reloads)
+    {
+        std::istringstream rs(l);
+        uint64_t due = 0;
+        std::string file;
+        if (!(rs >> due) || !std::getline(rs.ignore(1), file) || file.empty())
+        {
+            Output::err() << "ERROR: malformed checkpoint reload, ignoring: " << l << std::endl;
+            continue;
+        }
+        state.reloads.emplace_back(due, file);
+    }
+    return true;
+}
+
+// -------------------------------------------------- restoreLoans ----------------------------------------------------
+void Checkpoint::restoreLoans(const State &state, Inventory &inventory, CustomerHashTable &customers)
+{
+    for (const Loan &loan : state.loans)
+    {
+        Customer *cust = customers.getCustomer(loan.customerId);
+        if (!cust)
+        {
+            Output::err() << "ERROR: checkpoint loan for unknown customer " << loan.customerId << std::endl;
+            continue;
+        }
+        for (int i = 0; i < loan.copies; ++i)
+        {
+            if (!inventory.borrowMovie(loan.category, loan.key, loan.customerId))
+            {
+                Output::err() << "ERROR: checkpoint loan could not be restored: " << loan.category << " '"
+                              << loan.key << "'" << std::endl;
+                break;
+            }
+        }
+        const Movie *movie = loan.held ? inventory.findMovie(loan.category, loan.key) : nullptr;
+        if (movie) cust->borrowMovie(inventory.getKey(movie));
+    }
+
+    for (const auto &entry : state.history)
+    {
+        Customer *cust = customers.getCustomer(entry.first);
+        if (cust) cust->addHistory(entry.second);
+    }
+    inventory.setCommandSeq(state.commandSeq);
+    for (const auto &reload : state.reloads) inventory.startReload(reload.second, reload.first);
+
+    std::vector<const Movie*> bySlot;
+    bySlot.reserve(inventory.getTitleCount());
+    for (int slot = 0; slot < inventory.getTitleCount(); ++slot) bySlot.push_back(inventory.getMovieAtSlot(slot));
+    if (!inventory.getPopularity().restoreState(state.popularity, bySlot))
+    {
+        Output::err() << "ERROR: malformed checkpoint popularity state, restarting it empty" << std::endl;
+    }
+    if (!inventory.getCoBorrows().restoreState(state.coBorrows, bySlot))
+    {
+        Output::err() << "ERROR: malformed checkpoint co-borrow state, restarting it empty" << std::endl;
+    }
+}
+
+// ----------------------------------------------------- remove -------------------------------------------------------
+void Checkpoint::remove(const std::string &path)
+{
+    std::remove(path.c_str());
+}
@@ -0,0 +1,94 @@
+// --------------------------------------------------- Checkpoint.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Resumable replay. A checkpoint records where the command stream stopped (byte offset + line number),
+//          how long the completed log was, the processor counters, and the state needed to rebuild the run:
+//          the catalog (in movies-file format, with total copies), outstanding loans, customer histories and the
+//          borrow statistics (T popularity, A co-borrows).
+// Notes  : - Written to "<file>.tmp" and renamed over <file>, so a crash never leaves a torn checkpoint.
+//          - Resume seeks straight to the saved offset, rebuilds inventory/loans/histories from the checkpoint
+//            (customer names still come from the customers file) and truncates the completed log to the saved
+//            length, so no command is logged twice.
+//          - The catalog is written in slot order, so the restored titles get the slots they had and the borrow
+//            statistics are saved and restored by slot: popularity (sketch cells, heavy-hitter tables, window
+//            events) and co-borrows (NEIGHBORS entries per title, RECENT borrows per customer); all bounded.
+//          - Reloads still pending are saved with their due command number and restarted on restore, so they are
+//            merged at the same command as in an uninterrupted run (the delta file is read again then).
+// Layout : "MOVIES_CHECKPOINT 5"
+//          "position <offset> <lineNo> <completedBytes> <executed> <skipped> <commandSeq>"
+//          "catalog <n>"  then n movies-file lines, in slot order
+//          "loans <n>"    then n lines "<customerId> <category> <copies> <held> <key>"; held is 1 if the key is in
+//                         the customer's borrowed set (a set: after returning one of two copies it no longer is)
+//          "history <n>"  then n lines "<customerId> <text>" (oldest first per customer)
+//          "reloads <n>"  then n lines "<dueCommandSeq> <file>" (oldest first; due 0 = as soon as staged)
+//          "popularity <n>" then n lines of PopularityTracker::saveState()
+//          "coborrows <n>"  then n lines of CoBorrowTracker::saveState()
+//          "end"
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>     // command sequence
+#include <ios>         // std::streamoff
+#include <string>
+#include <utility>     // std::pair
+#include <vector>
+
+class Inventory;           // fwd decl
+class CustomerHashTable;   // fwd decl
+
+class Checkpoint
+{
+public:
+    struct Loan
+    {
+        int         customerId;
+        char        category;
+        int         copies;
+        bool        held;   // key is in the customer's borrowed set
+        std::string key;
+    };
+
+    using Reload = std::pair<uint64_t, std::string>;   // (due command number, delta file)
+
+    struct State
+    {
+        std::streamoff                           offset         = 0;   // commands file, just past the last line done
+        int                                      lineNo         = 0;
+        std::streamoff                           completedBytes = 0;
+        int                                      executed       = 0;
+        int                                      skipped        = 0;
+        uint64_t                                 commandSeq     = 0;
+        std::string                              catalog;              // movies-file lines
+        std::vector<Loan>                        loans;
+        std::vector<std::pair<int, std::string>> history;
+        std::vector<Reload>                      reloads;
+        std::vector<std::string>                 popularity;           // PopularityTracker::saveState() lines
+        std::vector<std::string>                 coBorrows;            // CoBorrowTracker::saveState() lines
+    };
+
+    // ---------------------------------------------------- save ------------------------------------------------------
+    // Description: Capture inventory/customers plus the given position fields and write them atomically.
+    // Returns    : false (with an error message) if the checkpoint could not be written.
+    static bool save(const std::string &path, const State &position, Inventory &inventory,
+                     CustomerHashTable &customers);
+
+    // ---------------------------------------------------- read ------------------------------------------------------
+    // Description: Read a checkpoint.
+    // Returns    : false if there is none; a present but malformed file is reported and also yields false.
+    static bool read(const std::string &path, State &state);
+
+    // ------------------------------------------------ restoreLoans --------------------------------------------------
+    // Description: Re-apply loans, histories, the command number, pending reloads and borrow statistics from state
+    //              onto a freshly restored inventory and customer table.
+    static void restoreLoans(const State &state, Inventory &inventory, CustomerHashTable &customers);
+
+    // --------------------------------------------------- remove -----------------------------------------------------
+    // Description: Delete the checkpoint after a run completes, so the next run starts from the beginning.
+    static void remove(const std::string &path);
+};
+
+#endif // CHECKPOINT_H
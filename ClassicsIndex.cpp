@@ -0,0 +1,117 @@
+// ------------------------------------------------ ClassicsIndex.cpp -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Sorted flat array of Classics keyed by packed release date + actor prefix (see ClassicsIndex.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "ClassicsIndex.h"
+#include "classics.h"
+#include "StringPool.h"
+
+#include <algorithm>  // std::sort, std::inplace_merge, std::lower_bound, std::upper_bound
+#include <string>
+
+// ---------------------------------------------------- packKey -------------------------------------------------------
+// The actor's first four bytes, big-endian and zero-padded, order exactly like the names' own comparison.
+uint64_t ClassicsIndex::packKey(uint32_t date, std::string_view actor)
+{
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        prefix = (prefix << 8) | (i < actor.size() ? static_cast<unsigned char>(actor[i]) : 0u);
+    }
+    return static_cast<uint64_t>(date) << 32 | prefix;
+}
+
+bool ClassicsIndex::before(const Entry &a, const Entry &b)
+{
+    return a.key != b.key ? a.key < b.key : a.actor < b.actor;
+}
+
+bool ClassicsIndex::entryFor(const Movie *movie, Entry &out)
+{
+    const Classics *c = dynamic_cast<const Classics*>(movie);
+    if (!c) return false;
+
+    const std::string actor = std::string(c->getMajorActorFirst()) + " " + std::string(c->getMajorActorLast());
+    out.actor = StringPool::intern(actor);
+    out.key   = packKey(packDate(c->getYear(), c->getReleaseMonth()), out.actor);
+    out.movie = movie;
+    return true;
+}
+
+// ------------------------------------------------------- add --------------------------------------------------------
+void ClassicsIndex::add(const Movie *movie)
+{
+    Entry e;
+    if (!entryFor(movie, e)) return;
+    entries.insert(std::upper_bound(entries.begin(), entries.end(), e, before), e);
+}
+
+// ------------------------------------------------- prepare / merge --------------------------------------------------
+std::vector<ClassicsIndex::Entry> ClassicsIndex::prepare(const std::vector<const Movie*> &movies)
+{
+    std::vector<Entry> run;
+    for (const Movie *movie : movies)
+    {
+        Entry e;
+        if (entryFor(movie, e)) run.push_back(e);
+    }
+    std::sort(run.begin(), run.end(), before);
+    return run;
+}
+
+void ClassicsIndex::merge(const std::vector<Entry> &run)
+{
+    const size_t old = entries.size();
+    entries.insert(entries.end(), run.begin(), run.end());
+    std::inplace_merge(entries.begin(), entries.begin() + old, entries.end(), before);
+}
+
+// ------------------------------------------------------ range -------------------------------------------------------
+std::vector<const Movie*> ClassicsIndex::range(int fromYear, int fromMonth, int toYear, int toMonth) const
+{
+    const uint64_t lo = static_cast<uint64_t>(packDate(fromYear, fromMonth)) << 32;
+    const uint64_t hi = (static_cast<uint64_t>(packDate(toYear, toMonth)) << 32) | 0xFFFFFFFFull;
+
+    std::vector<const Movie*> out;
+    if (lo > hi) return out;
+
+    auto first = std::lower_bound(entries.begin(), entries.end(), lo,
+                                  [](const Entry &e, uint64_t k) { return e.key < k; });
+    for (auto it = first; it != entries.end() && it->key <= hi; ++it)
+    {
+        out.push_back(it->movie);
+    }
+    return out;
+}
+
+// ------------------------------------------------------ after -------------------------------------------------------
+std::vector<const Movie*> ClassicsIndex::after(int year, int month, std::string_view actor, size_t limit) const
+{
+    const Entry probe{packKey(packDate(year, month), actor), actor, nullptr};
+    auto first = std::upper_bound(entries.begin(), entries.end(), probe, before);
+
+    std::vector<const Movie*> out;
+    for (auto it = first; it != entries.end() && out.size() < limit; ++it)
+    {
+        out.push_back(it->movie);
+    }
+    return out;
+}
+
+// ----------------------------------------------------- ordered ------------------------------------------------------
+std::vector<const Movie*> ClassicsIndex::ordered() const
+{
+    std::vector<const Movie*> out;
+    out.reserve(entries.size());
+    for (const Entry &e : entries) out.push_back(e.movie);
+    return out;
+}
+
+size_t ClassicsIndex::size() const
+{
+    return entries.size();
+}
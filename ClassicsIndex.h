@@ -0,0 +1,75 @@
+// ------------------------------------------------- ClassicsIndex.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Classics ordered by a packed integer key in one sorted flat array, for release-date range queries and
+//          for the Classics display order (year, month, then major actor - the same order as the string keys).
+// Notes  : - key = (year * 16 + month) << 32 | the first four bytes of "First Last", big-endian. Integer order
+//            therefore follows display order, and only entries with the same date and actor prefix fall back to
+//            comparing the names themselves.
+//          - The array is kept sorted on every write: add() inserts one title in place, a batch is sorted on
+//            its own and merged in one pass, so loading N titles is one O(N log N) sort rather than N inserts.
+//            Nothing is ever re-ranked, and queries never modify the index.
+//          - A range query is two binary searches plus a scan over contiguous entries.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef CLASSICSINDEX_H
+#define CLASSICSINDEX_H
+
+#include "movie.h"
+#include <cstddef>        // size_t
+#include <cstdint>        // packed keys
+#include <string_view>    // interned actor names
+#include <vector>
+
+class ClassicsIndex
+{
+public:
+    // ------------------------------------------------- packDate -----------------------------------------------------
+    static uint32_t packDate(int year, int month)
+    {
+        return static_cast<uint32_t>(year) * 16u + static_cast<uint32_t>(month);
+    }
+
+    // ----------------------------------------------------- add ------------------------------------------------------
+    // Description: Index a Classics movie in place (other genres are ignored); O(log n) search plus the shift.
+    void add(const Movie *movie);
+
+    // ------------------------------------------------ prepare / merge -----------------------------------------------
+    // Description: A batch is indexed in two steps: prepare() builds the batch's sorted run (other genres are
+    //              ignored; it touches no index, so it may run on another thread) and merge() folds a run in with one
+    //              linear pass. O(k log k + n) however large the batch.
+    struct Entry
+    {
+        uint64_t         key;     // packed date << 32 | actor prefix
+        std::string_view actor;   // interned "First Last"
+        const Movie     *movie;
+    };
+    static std::vector<Entry> prepare(const std::vector<const Movie*> &movies);
+    void                      merge(const std::vector<Entry> &run);
+
+    // ---------------------------------------------------- range -----------------------------------------------------
+    // Description: Classics released from (fromYear, fromMonth) through (toYear, toMonth) inclusive, in display
+    //              order.
+    std::vector<const Movie*> range(int fromYear, int fromMonth, int toYear, int toMonth) const;
+
+    // ----------------------------------------------------- after ----------------------------------------------------
+    // Description: Up to 'limit' Classics that follow (year, month, actor) in display order; O(log n + limit).
+    std::vector<const Movie*> after(int year, int month, std::string_view actor, size_t limit) const;
+
+    // ---------------------------------------------------- ordered ---------------------------------------------------
+    // Description: Every indexed Classics in display order.
+    std::vector<const Movie*> ordered() const;
+
+    size_t size() const;
+
+private:
+    static uint64_t packKey(uint32_t date, std::string_view actor);
+    static bool     before(const Entry &a, const Entry &b);
+    static bool     entryFor(const Movie *movie, Entry &out);
+
+    std::vector<Entry> entries;   // sorted by before()
+};
+
+#endif // CLASSICSINDEX_H
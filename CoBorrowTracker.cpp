@@ -0,0 +1,212 @@
+// ------------------------------------------------ CoBorrowTracker.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Recent-borrow rings and decayed, bounded co-borrow neighbor lists (see CoBorrowTracker.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "CoBorrowTracker.h"
+
+#include <algorithm>  // std::rotate, std::swap, std::sort
+#include <cmath>      // std::exp2
+#include <limits>     // std::numeric_limits (exact weights)
+#include <sstream>    // checkpoint lines
+
+// ------------------------------------------------- CoBorrowTracker --------------------------------------------------
+CoBorrowTracker::CoBorrowTracker(uint64_t halfLife)
+    : halfLife(halfLife ? halfLife : 1)
+{
+}
+
+// -------------------------------------------------- recordBorrow ----------------------------------------------------
+void CoBorrowTracker::recordBorrow(int customerId, const Movie *movie, uint64_t seq)
+{
+    Recent &r = recent[customerId];
+    for (size_t i = 0; i < r.size; ++i)
+    {
+        if (r.movies[i] != movie) continue;
+
+        // Already recent: its pairs were counted when it came in, so it only becomes the newest again.
+        std::rotate(r.movies + i, r.movies + i + 1, r.movies + r.size);
+        return;
+    }
+
+    for (size_t i = 0; i < r.size; ++i)
+    {
+        bump(movie, r.movies[i], seq);
+        bump(r.movies[i], movie, seq);
+    }
+    if (r.size == RECENT)
+    {
+        std::rotate(r.movies, r.movies + 1, r.movies + RECENT);   // drop the oldest
+        --r.size;
+    }
+    r.movies[r.size++] = movie;
+}
+
+// ------------------------------------------------------ bump --------------------------------------------------------
+// One more co-borrow of 'other' in owner's list.
+void CoBorrowTracker::bump(const Movie *owner, const Movie *other, uint64_t seq)
+{
+    const size_t slot = static_cast<size_t>(owner->getSlot());
+    if (slot >= lists.size()) lists.resize(slot + 1);
+    List &l = lists[slot];
+
+    const double scale = decay(l.touched, seq);
+    if (scale != 1.0)
+    {
+        for (size_t i = 0; i < l.size; ++i) l.entries[i].weight *= scale;
+    }
+    l.touched = seq;
+
+    size_t pos = 0;
+    while (pos < l.size && l.entries[pos].movie != other) ++pos;
+    if (pos < l.size)
+    {
+        l.entries[pos].weight += 1.0;
+    }
+    else if (l.size < NEIGHBORS)
+    {
+        l.entries[l.size++] = Entry{other, 1.0};
+    }
+    else
+    {
+        // The list is sorted, so the last entry is the lightest.
+        pos = NEIGHBORS - 1;
+        l.entries[pos] = Entry{other, l.entries[pos].weight + 1.0};
+    }
+
+    // Restore heaviest-first order; ties keep the older entry first.
+    while (pos > 0 && l.entries[pos].weight > l.entries[pos - 1].weight)
+    {
+        std::swap(l.entries[pos], l.entries[pos - 1]);
+        --pos;
+    }
+}
+
+// ---------------------------------------------------- neighbors -----------------------------------------------------
+std::vector<CoBorrowTracker::Neighbor> CoBorrowTracker::neighbors(const Movie *movie, size_t k, uint64_t now) const
+{
+    std::vector<Neighbor> out;
+    const size_t slot = static_cast<size_t>(movie->getSlot());
+    if (slot >= lists.size()) return out;
+
+    const List &l = lists[slot];
+    const double scale = decay(l.touched, now);
+    for (size_t i = 0; i < l.size && out.size() < k; ++i)
+    {
+        out.push_back(Neighbor{l.entries[i].movie, l.entries[i].weight * scale});
+    }
+    return out;
+}
+
+// ------------------------------------------------------ decay -------------------------------------------------------
+double CoBorrowTracker::decay(uint64_t from, uint64_t to) const
+{
+    if (to <= from) return 1.0;
+    return std::exp2(-static_cast<double>(to - from) / static_cast<double>(halfLife));
+}
+
+uint64_t CoBorrowTracker::getHalfLife() const
+{
+    return halfLife;
+}
+
+// ---------------------------------------------------- saveState -----------------------------------------------------
+std::vector<std::string> CoBorrowTracker::saveState() const
+{
+    std::vector<std::string> lines;
+    for (size_t slot = 0; slot < lists.size(); ++slot)
+    {
+        const List &l = lists[slot];
+        if (l.size == 0) continue;
+
+        std::ostringstream line;
+        line.precision(std::numeric_limits<double>::max_digits10);
+        line << "list " << slot << " " << l.touched;
+        for (size_t i = 0; i < l.size; ++i) line << " " << l.entries[i].movie->getSlot() << " " << l.entries[i].weight;
+        lines.push_back(line.str());
+    }
+
+    // By customer id, so the same state always saves to the same text.
+    std::vector<int> ids;
+    ids.reserve(recent.size());
+    for (const auto &kv : recent) ids.push_back(kv.first);
+    std::sort(ids.begin(), ids.end());
+    for (int id : ids)
+    {
+        const Recent &r = recent.at(id);
+        std::string line = "recent " + std::to_string(id);
+        for (size_t i = 0; i < r.size; ++i) line += " " + std::to_string(r.movies[i]->getSlot());
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// --------------------------------------------------- restoreState ---------------------------------------------------
+bool CoBorrowTracker::restoreState(const std::vector<std::string> &lines, const std::vector<const Movie*> &bySlot)
+{
+    lists.clear();
+    recent.clear();
+
+    auto movieAt = [&bySlot](long long slot) -> const Movie*
+    {
+        return slot >= 0 && static_cast<size_t>(slot) < bySlot.size() ? bySlot[slot] : nullptr;
+    };
+
+    bool ok = true;
+    for (const std::string &line : lines)
+    {
+        std::istringstream ls(line);
+        std::string kind;
+        ls >> kind;
+        long long slot = 0;
+        if (kind == "list")
+        {
+            uint64_t touched = 0;
+            ok = (ls >> slot >> touched) && movieAt(slot);
+            if (ok)
+            {
+                if (static_cast<size_t>(slot) >= lists.size()) lists.resize(slot + 1);
+                List &l = lists[slot];
+                l.size    = 0;
+                l.touched = touched;
+
+                double weight = 0.0;
+                long long other = 0;
+                while (ok && ls >> other >> weight)
+                {
+                    ok = movieAt(other) && l.size < NEIGHBORS;
+                    if (ok) l.entries[l.size++] = Entry{movieAt(other), weight};
+                }
+                ok = ok && ls.eof();
+            }
+        }
+        else if (kind == "recent")
+        {
+            int id = 0;
+            ok = static_cast<bool>(ls >> id);
+            Recent r;
+            while (ok && ls >> slot)
+            {
+                ok = movieAt(slot) && r.size < RECENT;
+                if (ok) r.movies[r.size++] = movieAt(slot);
+            }
+            ok = ok && ls.eof();
+            if (ok) recent[id] = r;
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            lists.clear();
+            recent.clear();
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,97 @@
+// ------------------------------------------------ CoBorrowTracker.h -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Incremental "customers who borrowed this also borrowed" engine fed by BorrowCommand. Each borrow is
+//          paired with the customer's last RECENT distinct borrows, and each pair bumps both titles' neighbor
+//          lists. Borrowing a title that is still among those only makes it the most recent again, so repeated
+//          borrow/return cycles of one title do not inflate its pairs.
+// Notes  : - Neighbor lists hold at most NEIGHBORS titles, kept sorted by weight. A title not in a full list
+//            replaces the lightest entry and inherits its weight + 1 (space-saving, as in PopularityTracker), so a
+//            listed weight over-counts by at most the weight it evicted.
+//          - Weights decay by half every halfLife commands. A list's entries share one last-touched command
+//            number and are scaled together when the list is next touched, so decay never reorders a list and a
+//            query is a copy of at most NEIGHBORS entries: O(1) regardless of catalog or history size.
+//          - Titles are identified by Movie::getSlot() (stable; movies are never removed). Memory is
+//            O(titles co-borrowed * NEIGHBORS + active customers * RECENT).
+//          - saveState()/restoreState() write and read the lists and recent borrows as text lines by slot, for
+//            checkpoints.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef COBORROWTRACKER_H
+#define COBORROWTRACKER_H
+
+#include "movie.h"
+#include <cstddef>         // size_t
+#include <cstdint>         // command numbers
+#include <string>          // checkpoint lines
+#include <unordered_map>   // recent borrows per customer
+#include <vector>
+
+class CoBorrowTracker
+{
+public:
+    static const size_t RECENT    = 8;   // borrows per customer paired with the next one
+    static const size_t NEIGHBORS = 8;   // titles kept per neighbor list
+
+    struct Neighbor
+    {
+        const Movie *movie;
+        double       weight;   // decayed co-borrow count as of the query
+    };
+
+    explicit CoBorrowTracker(uint64_t halfLife = 10000);
+
+    // ------------------------------------------------ recordBorrow --------------------------------------------------
+    // Description: Pair 'movie' with the customer's recent borrows as of command number 'seq' (non-decreasing
+    //              across calls), unless it is one of them, then make it the customer's most recent borrow.
+    void recordBorrow(int customerId, const Movie *movie, uint64_t seq);
+
+    // ------------------------------------------------- neighbors ----------------------------------------------------
+    // Description: Up to 'k' titles most often borrowed together with 'movie', heaviest first, weights decayed to
+    //              command 'now'.
+    std::vector<Neighbor> neighbors(const Movie *movie, size_t k, uint64_t now) const;
+
+    uint64_t getHalfLife() const;
+
+    // ------------------------------------------------- saveState ----------------------------------------------------
+    // Description: Every non-empty neighbor list and every customer's recent borrows as text lines:
+    //              "list <slot> <touched> {<slot> <weight>}" (heaviest first, weights exact) and
+    //              "recent <customerId> {<slot>}" (oldest first).
+    std::vector<std::string> saveState() const;
+
+    // ------------------------------------------------ restoreState --------------------------------------------------
+    // Description: Replace the state with saveState() lines; bySlot maps a slot to its movie in this catalog.
+    // Returns    : false (state left empty) if a line is malformed or names an unknown slot.
+    bool restoreState(const std::vector<std::string> &lines, const std::vector<const Movie*> &bySlot);
+
+private:
+    struct Entry
+    {
+        const Movie *movie  = nullptr;
+        double       weight = 0.0;
+    };
+
+    struct List
+    {
+        Entry    entries[NEIGHBORS];
+        size_t   size    = 0;
+        uint64_t touched = 0;   // command number the weights are decayed to
+    };
+
+    struct Recent
+    {
+        const Movie *movies[RECENT] = {};   // oldest first
+        size_t       size = 0;
+    };
+
+    double decay(uint64_t from, uint64_t to) const;
+    void   bump(const Movie *owner, const Movie *other, uint64_t seq);
+
+    uint64_t                        halfLife;
+    std::vector<List>               lists;     // by Movie::getSlot(), grown on demand
+    std::unordered_map<int, Recent> recent;    // customer id -> last RECENT distinct borrows
+};
+
+#endif // COBORROWTRACKER_H
@@ -0,0 +1,318 @@
+// ------------------------------------------------- ColumnarFile.cpp -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Streaming writer and reader for the columnar export format (see ColumnarFile.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "ColumnarFile.h"
+
+static const char   MAGIC[]   = "MVCOL01\n";
+static const size_t MAGIC_LEN = 8;
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// Fixed-width little-endian encoding, independent of host byte order.
+static inline void putU8(std::ostream &out, uint8_t v)
+{
+    out.put(static_cast<char>(v));
+}
+
+static inline void putU16(std::ostream &out, uint16_t v)
+{
+    putU8(out, static_cast<uint8_t>(v));
+    putU8(out, static_cast<uint8_t>(v >> 8));
+}
+
+static inline void putU32(std::ostream &out, uint32_t v)
+{
+    for (int shift = 0; shift < 32; shift += 8) putU8(out, static_cast<uint8_t>(v >> shift));
+}
+
+static inline void putStr16(std::ostream &out, const std::string &s)
+{
+    putU16(out, static_cast<uint16_t>(s.size()));
+    out.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+static inline bool getU8(std::istream &in, uint8_t &v)
+{
+    char c;
+    if (!in.get(c)) return false;
+    v = static_cast<uint8_t>(c);
+    return true;
+}
+
+static inline bool getU16(std::istream &in, uint16_t &v)
+{
+    uint8_t lo, hi;
+    if (!getU8(in, lo) || !getU8(in, hi)) return false;
+    v = static_cast<uint16_t>(lo | (hi << 8));
+    return true;
+}
+
+static inline bool getU32(std::istream &in, uint32_t &v)
+{
+    unsigned char b[4];
+    if (!in.read(reinterpret_cast<char*>(b), 4)) return false;
+    v = static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8)
+      | (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
+    return true;
+}
+
+static inline bool getBytes(std::istream &in, std::string &s, size_t n)
+{
+    s.resize(n);
+    return n == 0 || static_cast<bool>(in.read(&s[0], static_cast<std::streamsize>(n)));
+}
+
+// -------------------------------------------------- ColumnarWriter --------------------------------------------------
+ColumnarWriter::ColumnarWriter(std::ostream &out, size_t chunkRows)
+    : out(out),
+      chunkRows(chunkRows == 0 ? CHUNK_ROWS : chunkRows),
+      pendingRows(0),
+      rowsWritten(0)
+{
+    out.write(MAGIC, MAGIC_LEN);
+}
+
+// --------------------------------------------------- beginTable -----------------------------------------------------
+void ColumnarWriter::beginTable(const std::string &name, const std::vector<ColumnSpec> &schema)
+{
+    flushChunk();
+
+    putU8(out, 'T');
+    putStr16(out, name);
+    putU16(out, static_cast<uint16_t>(schema.size()));
+    columns.clear();
+    for (const ColumnSpec &spec : schema)
+    {
+        putU8(out, static_cast<uint8_t>(spec.type));
+        putStr16(out, spec.name);
+        ColumnBuffer buf;
+        buf.type = spec.type;
+        columns.push_back(std::move(buf));
+    }
+}
+
+// ------------------------------------------------------ set ---------------------------------------------------------
+void ColumnarWriter::set(size_t column, int32_t value)
+{
+    ColumnBuffer &c = columns[column];
+    if (c.type == ColumnType::U8) c.bytes.push_back(static_cast<uint8_t>(value));
+    else                          c.ints.push_back(value);
+}
+
+void ColumnarWriter::set(size_t column, std::string_view value)
+{
+    ColumnBuffer &c = columns[column];
+    auto it = c.index.find(std::string(value));
+    if (it == c.index.end())
+    {
+        it = c.index.emplace(std::string(value), static_cast<uint32_t>(c.dict.size())).first;
+        c.dict.emplace_back(value);
+    }
+    c.codes.push_back(it->second);
+}
+
+// ------------------------------------------------------ endRow ------------------------------------------------------
+void ColumnarWriter::endRow()
+{
+    // Columns left unset for this row get 0 / "".
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        const ColumnBuffer &c = columns[i];
+        const size_t have = (c.type == ColumnType::U8)  ? c.bytes.size()
+                          : (c.type == ColumnType::I32) ? c.ints.size()
+                                                        : c.codes.size();
+        if (have > pendingRows) continue;
+        if (c.type == ColumnType::STR) set(i, std::string_view());
+        else                           set(i, 0);
+    }
+
+    ++pendingRows;
+    if (pendingRows >= chunkRows) flushChunk();
+}
+
+// --------------------------------------------------- flushChunk -----------------------------------------------------
+void ColumnarWriter::flushChunk()
+{
+    if (pendingRows == 0) return;
+
+    putU8(out, 'C');
+    putU32(out, static_cast<uint32_t>(pendingRows));
+    for (ColumnBuffer &c : columns)
+    {
+        switch (c.type)
+        {
+        case ColumnType::U8:
+            out.write(reinterpret_cast<const char*>(c.bytes.data()), static_cast<std::streamsize>(c.bytes.size()));
+            break;
+        case ColumnType::I32:
+            for (int32_t v : c.ints) putU32(out, static_cast<uint32_t>(v));
+            break;
+        case ColumnType::STR:
+            putU32(out, static_cast<uint32_t>(c.dict.size()));
+            for (const std::string &s : c.dict)
+            {
+                putU32(out, static_cast<uint32_t>(s.size()));
+                out.write(s.data(), static_cast<std::streamsize>(s.size()));
+            }
+            for (uint32_t code : c.codes) putU32(out, code);
+            break;
+        }
+        c.bytes.clear();
+        c.ints.clear();
+        c.codes.clear();
+        c.dict.clear();
+        c.index.clear();
+    }
+    rowsWritten += pendingRows;
+    pendingRows  = 0;
+}
+
+// ------------------------------------------------------ finish ------------------------------------------------------
+bool ColumnarWriter::finish()
+{
+    flushChunk();
+    putU8(out, 'E');
+    out.flush();
+    return static_cast<bool>(out);
+}
+
+size_t ColumnarWriter::getRowsWritten() const
+{
+    return rowsWritten;
+}
+
+// -------------------------------------------------- ColumnarReader --------------------------------------------------
+ColumnarReader::ColumnarReader(std::istream &in)
+    : in(in)
+{
+    std::string magic;
+    if (!getBytes(in, magic, MAGIC_LEN) || magic != std::string(MAGIC, MAGIC_LEN))
+    {
+        fail("not a columnar export (bad magic)");
+    }
+}
+
+bool ColumnarReader::ok() const
+{
+    return error.empty();
+}
+
+const std::string& ColumnarReader::getError() const
+{
+    return error;
+}
+
+bool ColumnarReader::fail(const std::string &why)
+{
+    if (error.empty()) error = why;
+    return false;
+}
+
+// ------------------------------------------------------- next -------------------------------------------------------
+bool ColumnarReader::next(Chunk &chunk)
+{
+    if (!ok()) return false;
+
+    uint8_t tag;
+    while (true)
+    {
+        if (!getU8(in, tag)) return fail("truncated file (missing end marker)");
+        if (tag == 'E') return false;
+        if (tag == 'C') break;
+        if (tag != 'T') return fail("unknown block tag");
+
+        // Table header: remember the schema for the chunks that follow.
+        uint16_t len, count;
+        if (!getU16(in, len) || !getBytes(in, table, len) || !getU16(in, count)) return fail("truncated table header");
+        schema.clear();
+        for (uint16_t i = 0; i < count; ++i)
+        {
+            uint8_t type;
+            ColumnSpec spec;
+            if (!getU8(in, type) || !getU16(in, len) || !getBytes(in, spec.name, len))
+            {
+                return fail("truncated column header");
+            }
+            if (type < static_cast<uint8_t>(ColumnType::U8) || type > static_cast<uint8_t>(ColumnType::STR))
+            {
+                return fail("unknown column type in " + table + "." + spec.name);
+            }
+            spec.type = static_cast<ColumnType>(type);
+            schema.push_back(std::move(spec));
+        }
+    }
+
+    if (schema.empty()) return fail("chunk before any table header");
+
+    uint32_t rows;
+    if (!getU32(in, rows)) return fail("truncated chunk header");
+
+    chunk.table  = table;
+    chunk.schema = schema;
+    chunk.rows   = rows;
+    chunk.columns.assign(schema.size(), Column());
+    for (size_t i = 0; i < schema.size(); ++i)
+    {
+        Column &c = chunk.columns[i];
+        c.type = schema[i].type;
+        switch (c.type)
+        {
+        case ColumnType::U8:
+            c.bytes.resize(rows);
+            if (rows && !in.read(reinterpret_cast<char*>(c.bytes.data()), rows)) return fail("truncated u8 column");
+            break;
+        case ColumnType::I32:
+            c.ints.resize(rows);
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                uint32_t v;
+                if (!getU32(in, v)) return fail("truncated i32 column");
+                c.ints[r] = static_cast<int32_t>(v);
+            }
+            break;
+        case ColumnType::STR:
+        {
+            uint32_t dictSize;
+            if (!getU32(in, dictSize)) return fail("truncated dictionary");
+            c.dict.resize(dictSize);
+            for (uint32_t d = 0; d < dictSize; ++d)
+            {
+                uint32_t len;
+                if (!getU32(in, len) || !getBytes(in, c.dict[d], len)) return fail("truncated dictionary entry");
+            }
+            c.codes.resize(rows);
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                if (!getU32(in, c.codes[r])) return fail("truncated string codes");
+                if (c.codes[r] >= dictSize) return fail("string code out of range in " + schema[i].name);
+            }
+            break;
+        }
+        }
+    }
+    return true;
+}
+
+// ---------------------------------------------------- accessors -----------------------------------------------------
+int32_t ColumnarReader::Column::intAt(size_t row) const
+{
+    return (type == ColumnType::U8) ? static_cast<int32_t>(bytes[row]) : ints[row];
+}
+
+std::string_view ColumnarReader::Column::strAt(size_t row) const
+{
+    return dict[codes[row]];
+}
+
+int ColumnarReader::Chunk::find(const std::string &name) const
+{
+    for (size_t i = 0; i < schema.size(); ++i)
+    {
+        if (schema[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
@@ -0,0 +1,136 @@
+// -------------------------------------------------- ColumnarFile.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Minimal columnar binary format for analytics exports, with a streaming writer and a reader library.
+//          A file holds one or more tables; each table is a schema followed by row chunks. Inside a chunk every
+//          column is one typed buffer, and string columns are dictionary encoded (dictionary + u32 codes).
+// Layout : (all integers little-endian)
+//            file   := "MVCOL01\n" table* 'E'
+//            table  := 'T' str16(name) u16(columnCount) { u8(type) str16(columnName) }* chunk*
+//            chunk  := 'C' u32(rows) column*              -- columns in schema order
+//            column := U8  : rows x u8
+//                    | I32 : rows x i32
+//                    | STR : u32(dictSize) { u32(len) bytes }* rows x u32(code)
+//          Dictionaries are per chunk, so the writer and reader each hold at most one chunk in memory.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef COLUMNARFILE_H
+#define COLUMNARFILE_H
+
+#include <cstddef>        // size_t
+#include <cstdint>        // fixed-width column values
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>  // dictionary encoding
+#include <vector>
+
+enum class ColumnType : uint8_t
+{
+    U8  = 1,
+    I32 = 2,
+    STR = 3
+};
+
+struct ColumnSpec
+{
+    std::string name;
+    ColumnType  type;
+};
+
+// ---------------------------------------------------- ColumnarWriter ------------------------------------------------
+class ColumnarWriter
+{
+public:
+    static const size_t CHUNK_ROWS = 65536;
+
+    // Description: Writes the file magic; out must be opened in binary mode and outlive the writer.
+    explicit ColumnarWriter(std::ostream &out, size_t chunkRows = CHUNK_ROWS);
+
+    // Description: Flush the open chunk and start a new table with the given schema.
+    void beginTable(const std::string &name, const std::vector<ColumnSpec> &columns);
+
+    // Description: Set one value of the current row (column index per schema; type must match).
+    void set(size_t column, int32_t value);
+    void set(size_t column, std::string_view value);
+
+    // Description: Commit the current row; writes a chunk when chunkRows rows are buffered.
+    void endRow();
+
+    // Description: Flush the open chunk and write the end marker. Returns false if the stream failed.
+    bool finish();
+
+    size_t getRowsWritten() const;
+
+private:
+    struct ColumnBuffer
+    {
+        ColumnType                                type;
+        std::vector<uint8_t>                      bytes;   // U8
+        std::vector<int32_t>                      ints;    // I32
+        std::vector<uint32_t>                     codes;   // STR
+        std::vector<std::string>                  dict;    // STR: code -> value
+        std::unordered_map<std::string, uint32_t> index;   // STR: value -> code
+    };
+
+    void flushChunk();
+
+    std::ostream             &out;
+    size_t                    chunkRows;
+    size_t                    pendingRows;
+    size_t                    rowsWritten;
+    std::vector<ColumnBuffer> columns;
+};
+
+// ---------------------------------------------------- ColumnarReader ------------------------------------------------
+class ColumnarReader
+{
+public:
+    // One decoded column of a chunk.
+    struct Column
+    {
+        ColumnType               type;
+        std::vector<uint8_t>     bytes;
+        std::vector<int32_t>     ints;
+        std::vector<uint32_t>    codes;
+        std::vector<std::string> dict;
+
+        int32_t          intAt(size_t row) const;   // U8 or I32
+        std::string_view strAt(size_t row) const;   // STR
+    };
+
+    // One chunk of rows from a table.
+    struct Chunk
+    {
+        std::string             table;
+        std::vector<ColumnSpec> schema;
+        size_t                  rows = 0;
+        std::vector<Column>     columns;
+
+        // Description: Index of the named column, or -1.
+        int find(const std::string &name) const;
+    };
+
+    // Description: Validates the magic; check ok() before reading.
+    explicit ColumnarReader(std::istream &in);
+
+    // Description: Decode the next chunk (of whatever table comes next).
+    // Returns    : false at the end marker or on a format error (then ok() is false and getError() says why).
+    bool next(Chunk &chunk);
+
+    bool               ok() const;
+    const std::string& getError() const;
+
+private:
+    bool fail(const std::string &why);
+
+    std::istream           &in;
+    std::string             table;
+    std::vector<ColumnSpec> schema;
+    std::string             error;
+};
+
+#endif // COLUMNARFILE_H
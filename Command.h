@@ -12,9 +12,25 @@
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include <string>
+#include <vector>
+
 class CustomerHashTable;   // fwd decl to avoid heavy includes in the interface
 class Inventory;           // fwd decl
 
+// The customer and titles a command looks up when it executes, so a dry run can check them read-only.
+struct CommandRefs
+{
+    struct Title
+    {
+        char        category;
+        std::string key;   // canonical movie key (see Movie::buildKey())
+    };
+
+    int                customerId = -1;   // -1 = no customer
+    std::vector<Title> titles;
+};
+
 class Command
 {
 public:
@@ -25,6 +41,20 @@ public:
     // Post: Performs the command’s action (may print to stdout/stderr, update state, etc.).
     // --------------------------------------------------------------------------------------------------------------
     virtual void execute(Inventory &inventory, CustomerHashTable &customers) const = 0;
+
+    // --------------------------------------------------------------------------------------------------------------
+    // references
+    // Post: Returns the customer/titles execute() would look up (none by default). Used by the validate-only mode
+    //       (see CommandValidator.h); must not depend on inventory state.
+    // --------------------------------------------------------------------------------------------------------------
+    virtual CommandRefs references() const { return CommandRefs(); }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // writesFiles
+    // Post: Returns true if execute() creates or overwrites files (false by default). Read-only replays skip such
+    //       commands (see CommandProcessor::setReadOnly).
+    // --------------------------------------------------------------------------------------------------------------
+    virtual bool writesFiles() const { return false; }
 };
 
 #endif // COMMAND_H
\ No newline at end of file
@@ -4,17 +4,47 @@
 //   H <id>
 //   B <id> D <type> <descriptor...>
 //   R <id> D <type> <descriptor...>
-// Where <type> is 'F','D','C' and media is 'D' (DVD). Invalid lines are reported and skipped.
+//   S <text>
+//   P <N> <prefix>
+//   T [genre] [k]
+//   O [id]
+//   L <file>
+//   E <file>
+//   Y <from> <to>                  (bounds: YYYY or YYYY-MM)
+//   G <genre> <pageSize> [cursor]
+//   M
+//   V
+//   N <N> <surnamePrefix> | N <N> <last> <first>
+//   A D <type> <descriptor...>
+//   U <+/-copies> D <type> <descriptor...> [; <+/-copies> D <type> <descriptor...>]...
+// Where <type> is a genre code from MovieFactory's GENRE_TABLE ('F','D','C','N','W') and media is 'D' (DVD).
+// The descriptor layout follows the genre's KeyShape. Invalid lines are reported and skipped.
 
 #include "CommandFactory.h"
 #include "InventoryCommand.h"
 #include "HistoryCommand.h"
 #include "BorrowCommand.h"
 #include "ReturnCommand.h"
+#include "SearchCommand.h"
+#include "PrefixCommand.h"
+#include "TopCommand.h"
+#include "OutstandingCommand.h"
+#include "ReloadCommand.h"
+#include "ExportCommand.h"
+#include "DateRangeCommand.h"
+#include "PageCommand.h"
+#include "MemoryCommand.h"
+#include "StatsCommand.h"
+#include "NameCommand.h"
+#include "AlsoCommand.h"
+#include "RestockCommand.h"
+#include "MovieFactory.h"
+#include "Output.h"
 #include <sstream>
 #include <iostream>
 #include <cctype>
 #include <stdexcept>
+#include <vector>
 
 // ----------------------------------------------- helpers ------------------------------------------------------------
 static inline std::string trim(const std::string &s)
@@ -57,24 +87,305 @@ static Command* parseHistory(const std::string &line)
     char code; int id;
     if (!(ss >> code >> id))
     {
-        std::cerr << "ERROR: bad History command: " << line << std::endl;
+        Output::err() << "ERROR: bad History command: " << line << std::endl;
         return nullptr;
     }
     return new HistoryCommand(id);
 }
 
+static Command* parseSearch(const std::string &line)
+{
+    std::string text = trim(trim(line).substr(1));
+    if (text.empty())
+    {
+        Output::err() << "ERROR: bad Search command: " << line << std::endl;
+        return nullptr;
+    }
+    return new SearchCommand(text);
+}
+
+static Command* parsePrefix(const std::string &line)
+{
+    std::istringstream ss(line);
+    char code; int limit;
+    std::string prefix;
+    if (!(ss >> code >> limit) || limit <= 0)
+    {
+        Output::err() << "ERROR: bad Prefix command: " << line << std::endl;
+        return nullptr;
+    }
+    std::getline(ss, prefix);
+    prefix = trim(prefix);
+    if (prefix.empty())
+    {
+        Output::err() << "ERROR: bad Prefix command: " << line << std::endl;
+        return nullptr;
+    }
+    return new PrefixCommand(static_cast<size_t>(limit), prefix);
+}
+
+static Command* parseTop(const std::string &line)
+{
+    std::istringstream ss(trim(line).substr(1));
+    std::string tok;
+    char category = 0;
+    int k = 10;
+
+    if (ss >> tok)
+    {
+        if (std::isalpha(static_cast<unsigned char>(tok[0])) && tok.size() == 1)
+        {
+            if (!MovieFactory::findGenre(tok[0]))
+            {
+                Output::err() << "ERROR: invalid movie code '" << tok[0] << "' in: " << line << std::endl;
+                return nullptr;
+            }
+            category = tok[0];
+            if (!(ss >> tok)) tok.clear();
+        }
+        if (!tok.empty())
+        {
+            std::istringstream ks(tok);
+            std::string extra;
+            if (!(ks >> k) || k <= 0 || (ks >> extra) || (ss >> extra))
+            {
+                Output::err() << "ERROR: bad Top command: " << line << std::endl;
+                return nullptr;
+            }
+        }
+    }
+    return new TopCommand(category, static_cast<size_t>(k));
+}
+
+static Command* parseOutstanding(const std::string &line)
+{
+    std::istringstream ss(trim(line).substr(1));
+    int id = -1;
+    std::string extra;
+    if ((ss >> std::ws).peek() != EOF && (!(ss >> id) || id < 0 || (ss >> extra)))
+    {
+        Output::err() << "ERROR: bad Outstanding command: " << line << std::endl;
+        return nullptr;
+    }
+    return new OutstandingCommand(id);
+}
+
+static Command* parseReload(const std::string &line)
+{
+    std::string file = trim(trim(line).substr(1));
+    if (file.empty())
+    {
+        Output::err() << "ERROR: bad Reload command: " << line << std::endl;
+        return nullptr;
+    }
+    return new ReloadCommand(file);
+}
+
+static Command* parseExport(const std::string &line)
+{
+    std::string file = trim(trim(line).substr(1));
+    if (file.empty())
+    {
+        Output::err() << "ERROR: bad Export command: " << line << std::endl;
+        return nullptr;
+    }
+    return new ExportCommand(file);
+}
+
+// "YYYY" or "YYYY-MM"; a bare year takes defaultMonth.
+static bool parseYearMonth(const std::string &tok, int defaultMonth, int &year, int &month)
+{
+    std::istringstream ss(tok);
+    char dash = 0;
+    std::string extra;
+    if (!(ss >> year) || year < 0) return false;
+    month = defaultMonth;
+    if (ss >> dash)
+    {
+        if (dash != '-' || !(ss >> month) || month < 1 || month > 12) return false;
+    }
+    return !(ss >> extra);
+}
+
+static Command* parseDateRange(const std::string &line)
+{
+    std::istringstream ss(trim(line).substr(1));
+    std::string from, to, extra;
+    int fromYear, fromMonth, toYear, toMonth;
+    if (!(ss >> from >> to) || (ss >> extra)
+        || !parseYearMonth(from, 1, fromYear, fromMonth) || !parseYearMonth(to, 12, toYear, toMonth))
+    {
+        Output::err() << "ERROR: bad Date range command: " << line << std::endl;
+        return nullptr;
+    }
+    return new DateRangeCommand(fromYear, fromMonth, toYear, toMonth);
+}
+
+static Command* parsePage(const std::string &line)
+{
+    std::istringstream ss(trim(line).substr(1));
+    std::string genre, cursor, key, extra;
+    int pageSize = 0;
+    if (!(ss >> genre >> pageSize) || pageSize <= 0 || genre.size() != 1)
+    {
+        Output::err() << "ERROR: bad Page command: " << line << std::endl;
+        return nullptr;
+    }
+    if (!MovieFactory::findGenre(genre[0]))
+    {
+        Output::err() << "ERROR: invalid movie code '" << genre[0] << "' in: " << line << std::endl;
+        return nullptr;
+    }
+    if ((ss >> cursor) && ((ss >> extra) || !PageCommand::decodeCursor(cursor, key)))
+    {
+        Output::err() << "ERROR: bad Page cursor: " << line << std::endl;
+        return nullptr;
+    }
+    return new PageCommand(genre[0], static_cast<size_t>(pageSize), key);
+}
+
+static Command* parseMemory(const std::string &line)
+{
+    if (trim(line).size() != 1)
+    {
+        Output::err() << "ERROR: bad Memory command: " << line << std::endl;
+        return nullptr;
+    }
+    return new MemoryCommand();
+}
+
+static Command* parseStats(const std::string &line)
+{
+    if (trim(line).size() != 1)
+    {
+        Output::err() << "ERROR: bad Stats command: " << line << std::endl;
+        return nullptr;
+    }
+    return new StatsCommand();
+}
+
+static Command* parseName(const std::string &line)
+{
+    std::istringstream ss(line);
+    char code; int limit;
+    std::string last, first, extra;
+    if (!(ss >> code >> limit >> last) || limit <= 0 || (ss >> first && ss >> extra))
+    {
+        Output::err() << "ERROR: bad Name command: " << line << std::endl;
+        return nullptr;
+    }
+    return new NameCommand(static_cast<size_t>(limit), last, first);
+}
+
+// Title descriptor after "<type>" in B/R/A lines; the layout follows the genre's KeyShape. Numeric fields throw
+// std::exception on bad input (callers report it).
+struct TitleDescriptor
+{
+    std::string title;
+    int         year  = 0;
+    std::string director;
+    int         month = 0;
+    std::string actor;
+};
+
+static bool parseDescriptor(const std::string &line, const GenreInfo &genre, const std::string &rest,
+                            TitleDescriptor &d)
+{
+    if (genre.shape == KeyShape::TITLE_YEAR)
+    {
+        // Title, Year
+        size_t comma = rest.rfind(',');
+        if (comma == std::string::npos)
+        {
+            Output::err() << "ERROR: bad " << genre.label << " command: " << line << std::endl;
+            return false;
+        }
+        d.title = trim(rest.substr(0, comma));
+        d.year  = std::stoi(trim(rest.substr(comma + 1)));
+    }
+    else if (genre.shape == KeyShape::DIRECTOR_TITLE)
+    {
+        // Director, Title,
+        size_t comma1 = rest.find(',');
+        if (comma1 == std::string::npos)
+        {
+            Output::err() << "ERROR: bad " << genre.label << " command: " << line << std::endl;
+            return false;
+        }
+        d.director = trim(rest.substr(0, comma1));
+        d.title    = rtrimComma(rest.substr(comma1 + 1));
+    }
+    else
+    {
+        // month year First Last
+        std::istringstream tss(rest);
+        std::string first, last;
+        if (!(tss >> d.month >> d.year >> first >> last))
+        {
+            Output::err() << "ERROR: bad " << genre.label << " command: " << line << std::endl;
+            return false;
+        }
+        d.actor = first + " " + last;
+    }
+    return true;
+}
+
 static Command* parseBorrowOrReturn(const std::string &line, bool isBorrow)
 {
     std::istringstream ss(line);
     char code; int customerId; char media; char type;
     if (!(ss >> code >> customerId >> media >> type))
     {
-        std::cerr << "ERROR: bad command: " << line << std::endl;
+        Output::err() << "ERROR: bad command: " << line << std::endl;
+        return nullptr;
+    }
+    if (media != 'D')
+    {
+        Output::err() << "ERROR: invalid media type '" << media << "' in: " << line << std::endl;
+        return nullptr;
+    }
+
+    std::string rest; std::getline(ss, rest);
+    rest = trim(rest);
+
+    try
+    {
+        const GenreInfo *genre = MovieFactory::findGenre(type);
+        if (!genre)
+        {
+            Output::err() << "ERROR: invalid movie code '" << type << "' in: " << line << std::endl;
+            return nullptr;
+        }
+
+        TitleDescriptor d;
+        if (!parseDescriptor(line, *genre, rest, d)) return nullptr;
+        if (genre->shape == KeyShape::DATE_ACTOR)
+        {
+            if (isBorrow) return new BorrowCommand(customerId, type, d.month, d.year, d.actor);
+            else          return new ReturnCommand(customerId, type, d.month, d.year, d.actor);
+        }
+        if (isBorrow) return new BorrowCommand(customerId, type, d.title, d.year, d.director);
+        else          return new ReturnCommand(customerId, type, d.title, d.year, d.director);
+    }
+    catch (const std::exception &)
+    {
+        Output::err() << "ERROR: numeric parse failure in: " << line << std::endl;
+        return nullptr;
+    }
+}
+
+static Command* parseAlso(const std::string &line)
+{
+    std::istringstream ss(line);
+    char code; char media; char type;
+    if (!(ss >> code >> media >> type))
+    {
+        Output::err() << "ERROR: bad Also command: " << line << std::endl;
         return nullptr;
     }
     if (media != 'D')
     {
-        std::cerr << "ERROR: invalid media type '" << media << "' in: " << line << std::endl;
+        Output::err() << "ERROR: invalid media type '" << media << "' in: " << line << std::endl;
         return nullptr;
     }
 
@@ -83,59 +394,74 @@ static Command* parseBorrowOrReturn(const std::string &line, bool isBorrow)
 
     try
     {
-        if (type == 'F')
+        const GenreInfo *genre = MovieFactory::findGenre(type);
+        if (!genre)
         {
-            // Title, Year
-            size_t comma = rest.rfind(',');
-            if (comma == std::string::npos)
+            Output::err() << "ERROR: invalid movie code '" << type << "' in: " << line << std::endl;
+            return nullptr;
+        }
+
+        TitleDescriptor d;
+        if (!parseDescriptor(line, *genre, rest, d)) return nullptr;
+        return new AlsoCommand(type, MovieFactory::keyFor(type, d.title, d.year, d.director, d.month, d.actor));
+    }
+    catch (const std::exception &)
+    {
+        Output::err() << "ERROR: numeric parse failure in: " << line << std::endl;
+        return nullptr;
+    }
+}
+
+// One restock line holds many items separated by ';'; any bad item rejects the whole line.
+static Command* parseRestock(const std::string &line)
+{
+    std::vector<RestockCommand::Item> items;
+    std::istringstream all(trim(line).substr(1));
+    std::string part;
+    try
+    {
+        while (std::getline(all, part, ';'))
+        {
+            std::istringstream ss(part);
+            int delta; char media; char type;
+            if (!(ss >> delta >> media >> type) || delta == 0)
             {
-                std::cerr << "ERROR: bad Comedy command: " << line << std::endl;
+                Output::err() << "ERROR: bad Restock item '" << trim(part) << "' in: " << line << std::endl;
                 return nullptr;
             }
-            std::string title = trim(rest.substr(0, comma));
-            int year = std::stoi(trim(rest.substr(comma + 1)));
-            if (isBorrow) return new BorrowCommand(customerId, type, title, year, /*director*/"");
-            else          return new ReturnCommand(customerId, type, title, year, /*director*/"");
-        }
-        else if (type == 'D')
-        {
-            // Director, Title,
-            size_t comma1 = rest.find(',');
-            if (comma1 == std::string::npos)
+            if (media != 'D')
             {
-                std::cerr << "ERROR: bad Drama command: " << line << std::endl;
+                Output::err() << "ERROR: invalid media type '" << media << "' in: " << line << std::endl;
                 return nullptr;
             }
-            std::string director = trim(rest.substr(0, comma1));
-            std::string title    = rtrimComma(rest.substr(comma1 + 1));
-            if (isBorrow) return new BorrowCommand(customerId, type, title, /*year*/0, director);
-            else          return new ReturnCommand(customerId, type, title, /*year*/0, director);
-        }
-        else if (type == 'C')
-        {
-            // month year First Last
-            std::istringstream tss(rest);
-            int month, year; std::string first, last;
-            if (!(tss >> month >> year >> first >> last))
+            const GenreInfo *genre = MovieFactory::findGenre(type);
+            if (!genre)
             {
-                std::cerr << "ERROR: bad Classics command: " << line << std::endl;
+                Output::err() << "ERROR: invalid movie code '" << type << "' in: " << line << std::endl;
                 return nullptr;
             }
-            std::string actor = first + " " + last;
-            if (isBorrow) return new BorrowCommand(customerId, type, month, year, actor);
-            else          return new ReturnCommand(customerId, type, month, year, actor);
-        }
-        else
-        {
-            std::cerr << "ERROR: invalid movie code '" << type << "' in: " << line << std::endl;
-            return nullptr;
+
+            std::string rest; std::getline(ss, rest);
+            TitleDescriptor d;
+            if (!parseDescriptor(line, *genre, trim(rest), d)) return nullptr;
+            items.push_back(RestockCommand::Item{type,
+                                                 MovieFactory::keyFor(type, d.title, d.year, d.director, d.month,
+                                                                      d.actor),
+                                                 delta});
         }
     }
     catch (const std::exception &)
     {
-        std::cerr << "ERROR: numeric parse failure in: " << line << std::endl;
+        Output::err() << "ERROR: numeric parse failure in: " << line << std::endl;
+        return nullptr;
+    }
+
+    if (items.empty())
+    {
+        Output::err() << "ERROR: bad Restock command: " << line << std::endl;
         return nullptr;
     }
+    return new RestockCommand(std::move(items));
 }
 
 static Command* parseBorrow(const std::string &line) { return parseBorrowOrReturn(line, true);  }
@@ -148,6 +474,19 @@ static bool ensureRegistered()
     CommandFactory::registerCommand('H', parseHistory);
     CommandFactory::registerCommand('B', parseBorrow);
     CommandFactory::registerCommand('R', parseReturn);
+    CommandFactory::registerCommand('S', parseSearch);
+    CommandFactory::registerCommand('P', parsePrefix);
+    CommandFactory::registerCommand('T', parseTop);
+    CommandFactory::registerCommand('O', parseOutstanding);
+    CommandFactory::registerCommand('L', parseReload);
+    CommandFactory::registerCommand('E', parseExport);
+    CommandFactory::registerCommand('Y', parseDateRange);
+    CommandFactory::registerCommand('G', parsePage);
+    CommandFactory::registerCommand('M', parseMemory);
+    CommandFactory::registerCommand('V', parseStats);
+    CommandFactory::registerCommand('N', parseName);
+    CommandFactory::registerCommand('A', parseAlso);
+    CommandFactory::registerCommand('U', parseRestock);
     return true;
 }
 
@@ -164,7 +503,7 @@ Command* CommandFactory::createCommand(const std::string &line)
     auto it = getRegistry().find(type);
     if (it == getRegistry().end())
     {
-        std::cerr << "ERROR: invalid action code '" << type << "' in: " << line << std::endl;
+        Output::err() << "ERROR: invalid action code '" << type << "' in: " << line << std::endl;
         return nullptr;
     }
     return it->second(line);
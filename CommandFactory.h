@@ -3,8 +3,8 @@
 // Creation Date: <2025-08-20>
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
-// Purpose: Factory/registry that maps the leading action code in a line ('I','H','B','R') to a parser function that
-//          constructs a concrete Command.
+// Purpose: Factory/registry that maps the leading action code in a line (e.g. 'I','H','B','R') to a parser function
+//          that constructs a concrete Command. The full list of codes is documented at the top of CommandFactory.cpp.
 // Notes  : - To add a new command, register its parser in ensureRegistered() in CommandFactory.cpp.
 //          - Lines that fail to parse return nullptr and should be skipped by the caller.
 // --------------------------------------------------------------------------------------------------------------------
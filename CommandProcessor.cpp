@@ -0,0 +1,98 @@
+// ----------------------------------------------- CommandProcessor.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Line-at-a-time parse/execute loop body with completed-command logging (see CommandProcessor.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "CommandProcessor.h"
+#include "CommandFactory.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "Output.h"
+
+#include <exception>  // std::exception
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline bool isBlank(const std::string &s)
+{
+    return s.find_first_not_of(" \t\r\n") == std::string::npos;
+}
+
+// ------------------------------------------------ CommandProcessor --------------------------------------------------
+CommandProcessor::CommandProcessor(Inventory &inventory, CustomerHashTable &customers, std::ostream &completed)
+    : inventory(inventory),
+      customers(customers),
+      completed(completed),
+      executed(0),
+      skipped(0),
+      readOnly(false)
+{
+}
+
+// --------------------------------------------------- processLine ----------------------------------------------------
+bool CommandProcessor::processLine(const std::string &line, int lineNo)
+{
+    if (isBlank(line)) return false;
+
+    return processParsed(line, lineNo, CommandFactory::createCommand(line));
+}
+
+// -------------------------------------------------- processParsed ---------------------------------------------------
+bool CommandProcessor::processParsed(const std::string &line, int lineNo, Command *cmd)
+{
+    if (!cmd)
+    {
+        ++skipped;
+        return false;
+    }
+
+    inventory.applyReload(false);   // merge the reloads due at this command (see Inventory::startReload)
+    inventory.advanceCommandSeq();
+
+    bool ok = false;
+    try
+    {
+        if (!readOnly || !cmd->writesFiles()) cmd->execute(inventory, customers);
+        completed << line << "\n";   // record only parsed+executed commands
+        ++executed;
+        ok = true;
+    }
+    catch (const std::exception &e)
+    {
+        Output::err() << "ERROR: [command line " << lineNo << "] exception: " << e.what()
+                      << " while executing -> " << line << std::endl;
+    }
+    catch (...)
+    {
+        Output::err() << "ERROR: [command line " << lineNo << "] unknown exception while executing -> "
+                      << line << std::endl;
+    }
+
+    delete cmd;
+    return ok;
+}
+
+// ---------------------------------------------------- counters ------------------------------------------------------
+int CommandProcessor::getExecuted() const
+{
+    return executed;
+}
+
+int CommandProcessor::getSkipped() const
+{
+    return skipped;
+}
+
+void CommandProcessor::resumeCounts(int executed, int skipped)
+{
+    this->executed = executed;
+    this->skipped  = skipped;
+}
+
+// --------------------------------------------------- setReadOnly ----------------------------------------------------
+void CommandProcessor::setReadOnly(bool on)
+{
+    readOnly = on;
+}
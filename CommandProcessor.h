@@ -0,0 +1,60 @@
+// ------------------------------------------------ CommandProcessor.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Parses and executes command lines against one Inventory + CustomerHashTable pair, appending every
+//          executed line to a completed-commands log and counting executed vs. skipped lines.
+// Notes  : Shared by the single-store driver in main.cpp and by each store shard (see StoreShards.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef COMMANDPROCESSOR_H
+#define COMMANDPROCESSOR_H
+
+#include <ostream>   // completed log stream
+#include <string>
+
+class Inventory;           // fwd decl
+class CustomerHashTable;   // fwd decl
+class Command;             // fwd decl
+
+class CommandProcessor
+{
+public:
+    CommandProcessor(Inventory &inventory, CustomerHashTable &customers, std::ostream &completed);
+
+    // ------------------------------------------------ processLine ---------------------------------------------------
+    // Description: Parse and execute one line. Blank lines are ignored; lines that fail to parse are counted as
+    //              skipped; exceptions thrown while executing are reported with the line number.
+    // Returns    : true if the command executed (and was logged to the completed stream).
+    bool processLine(const std::string &line, int lineNo);
+
+    // ----------------------------------------------- processParsed --------------------------------------------------
+    // Description: Execute a line that was already parsed elsewhere (e.g. prefetched at startup). Takes ownership
+    //              of cmd; a null cmd counts as skipped. Any parse diagnostics must have been printed by the caller.
+    // Returns    : true if the command executed (and was logged to the completed stream).
+    bool processParsed(const std::string &line, int lineNo, Command *cmd);
+
+    // ------------------------------------------------- counters -----------------------------------------------------
+    int getExecuted() const;
+    int getSkipped()  const;
+
+    // Description: Continue counting from a checkpoint's totals.
+    void resumeCounts(int executed, int skipped);
+
+    // ------------------------------------------------ setReadOnly ---------------------------------------------------
+    // Description: With on, commands that write files (Command::writesFiles, e.g. E) are not executed; they still
+    //              take their command number and are counted and logged as executed, so later commands see the
+    //              same sequence as in the original run.
+    void setReadOnly(bool on);
+
+private:
+    Inventory         &inventory;
+    CustomerHashTable &customers;
+    std::ostream      &completed;
+    int                executed;
+    int                skipped;
+    bool               readOnly;
+};
+
+#endif // COMMANDPROCESSOR_H
@@ -0,0 +1,214 @@
+// ----------------------------------------------- CommandValidator.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Line-aligned range split, per-range parse + read-only lookups, and the merged report
+//           (see CommandValidator.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "CommandValidator.h"
+#include "CommandFactory.h"
+#include "Command.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "LineScanner.h"
+#include "Output.h"
+
+#include <fstream>      // range boundaries
+#include <functional>   // std::ref
+#include <iostream>     // std::endl
+#include <limits>       // std::numeric_limits
+#include <sstream>      // captured parse diagnostics
+#include <thread>
+
+static const char *const CATEGORY_NAMES[CommandValidator::CATEGORY_COUNT] =
+{
+    "parse errors", "unknown customers", "unknown titles"
+};
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline bool isBlank(std::string_view s)
+{
+    return s.find_first_not_of(" \t\r\n") == std::string_view::npos;
+}
+
+// Parse diagnostics as one line: "ERROR: " prefixes dropped, several messages joined with "; ".
+static std::string diagnostics(const std::string &text)
+{
+    std::string out;
+    std::istringstream in(text);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.compare(0, 7, "ERROR: ") == 0) line.erase(0, 7);
+        if (line.empty()) continue;
+        if (!out.empty()) out += "; ";
+        out += line;
+    }
+    return out;
+}
+
+// ----------------------------------------------- CommandValidator ---------------------------------------------------
+CommandValidator::CommandValidator(Inventory &inventory, CustomerHashTable &customers)
+    : inventory(inventory),
+      customers(customers)
+{
+}
+
+// --------------------------------------------------- validate -------------------------------------------------------
+bool CommandValidator::validate(const std::string &commandsFile, unsigned threads)
+{
+    std::ifstream in(commandsFile, std::ios::binary | std::ios::ate);
+    if (!in)
+    {
+        Output::err() << "ERROR: cannot open commands file: " << commandsFile << std::endl;
+        return false;
+    }
+    const std::streamoff size = in.tellg();
+
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    size_t count = static_cast<size_t>(size) / MIN_RANGE_BYTES;
+    if (count > threads) count = threads;
+    if (count == 0) count = 1;
+
+    // Each cut moves forward to just past the next newline, so every range starts at the beginning of a line.
+    ranges.assign(count, Range());
+    std::streamoff begin = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::streamoff end = size;
+        if (i + 1 < count)
+        {
+            const std::streamoff target = size * static_cast<std::streamoff>(i + 1)
+                                        / static_cast<std::streamoff>(count);
+            in.clear();
+            in.seekg(target > 0 ? target - 1 : 0);
+            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            end = in.eof() ? size : static_cast<std::streamoff>(in.tellg());
+            if (end < begin) end = begin;
+        }
+        ranges[i].begin = begin;
+        ranges[i].end   = end;
+        begin = end;
+    }
+
+    std::vector<std::thread> pool;
+    for (size_t i = 1; i < ranges.size(); ++i)
+    {
+        pool.emplace_back(&CommandValidator::check, this, std::ref(ranges[i]), std::cref(commandsFile));
+    }
+    check(ranges[0], commandsFile);
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+
+    // Merge in file order, turning range-relative line numbers into file line numbers.
+    problems.clear();
+    lines = commands = 0;
+    for (size_t &c : counts) c = 0;
+    for (Range &range : ranges)
+    {
+        if (!range.opened)
+        {
+            Output::err() << "ERROR: cannot open commands file: " << commandsFile << std::endl;
+            return false;
+        }
+        for (Problem &problem : range.problems)
+        {
+            problem.lineNo += lines;
+            ++counts[problem.category];
+            problems.push_back(std::move(problem));
+        }
+        range.problems.clear();
+        lines    += range.lines;
+        commands += range.commands;
+    }
+    return true;
+}
+
+// ----------------------------------------------------- check --------------------------------------------------------
+// Runs on a worker: parses [range.begin, range.end) and looks up what each command refers to, without executing.
+void CommandValidator::check(Range &range, const std::string &commandsFile)
+{
+    LineReader reader;
+    if (!reader.open(commandsFile))
+    {
+        range.opened = false;
+        return;
+    }
+    reader.seek(range.begin);
+
+    // The factory reports parse errors on Output::err(); capture them per line instead of printing.
+    std::ostringstream captured;
+    Output::Redirect redirect(captured, captured);
+
+    std::string_view view;
+    while (reader.offset() < range.end && reader.next(view))
+    {
+        const int lineNo = ++range.lines;
+        if (isBlank(view)) continue;
+        ++range.commands;
+
+        const std::string line(view);
+        Command *cmd = CommandFactory::createCommand(line);
+        if (!cmd)
+        {
+            range.problems.push_back(Problem{lineNo, PARSE_ERROR, diagnostics(captured.str()), line});
+            captured.str("");
+            captured.clear();
+            continue;
+        }
+        captured.str("");
+        captured.clear();
+
+        const CommandRefs refs = cmd->references();
+        delete cmd;
+        if (refs.customerId >= 0 && !customers.getCustomer(refs.customerId))
+        {
+            range.problems.push_back(Problem{lineNo, UNKNOWN_CUSTOMER, std::to_string(refs.customerId), line});
+        }
+        for (const CommandRefs::Title &title : refs.titles)
+        {
+            if (inventory.findMovie(title.category, title.key)) continue;
+            range.problems.push_back(Problem{lineNo, UNKNOWN_TITLE,
+                                             std::string(1, title.category) + " '" + title.key + "'", line});
+        }
+    }
+}
+
+// ----------------------------------------------------- report -------------------------------------------------------
+void CommandValidator::report(std::ostream &out) const
+{
+    for (const Problem &problem : problems)
+    {
+        out << "[command line " << problem.lineNo << "] ";
+        if (problem.category == PARSE_ERROR)
+        {
+            out << "parse error: " << problem.detail << "\n";
+            continue;
+        }
+        out << (problem.category == UNKNOWN_CUSTOMER ? "unknown customer " : "unknown title ")
+            << problem.detail << " -> " << problem.line << "\n";
+    }
+
+    out << "Validated " << lines << " lines (" << commands << " commands):";
+    for (int c = 0; c < CATEGORY_COUNT; ++c)
+    {
+        out << (c ? " | " : " ") << CATEGORY_NAMES[c] << ": " << counts[c];
+    }
+    out << std::endl;
+}
+
+// ---------------------------------------------------- counters ------------------------------------------------------
+size_t CommandValidator::getProblemCount() const
+{
+    return problems.size();
+}
+
+size_t CommandValidator::getRangeCount() const
+{
+    return ranges.size();
+}
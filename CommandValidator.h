@@ -0,0 +1,88 @@
+// ------------------------------------------------ CommandValidator.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Validate-only (dry run) mode for a commands file. Every line is parsed through CommandFactory but never
+//          executed; the customer and titles each command would look up (Command::references()) are checked
+//          against the loaded state read-only. The result is a line-ordered problem report with counts per
+//          category: parse errors, unknown customers, unknown titles.
+// Notes  : - The file is split into byte ranges that start on line boundaries, one per worker thread; each worker
+//            reads only its range, and problems are merged back into file order, so the report does not depend on
+//            the thread count.
+//          - Nothing is executed, so lookups see the starting state: titles that only a reload ("L") would add
+//            are reported as unknown, and stock/loan problems (out of stock, returning a title not held) are not
+//            detected.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef COMMANDVALIDATOR_H
+#define COMMANDVALIDATOR_H
+
+#include <cstddef>   // size_t
+#include <ios>       // std::streamoff
+#include <ostream>
+#include <string>
+#include <vector>
+
+class Inventory;           // fwd decl
+class CustomerHashTable;   // fwd decl
+
+class CommandValidator
+{
+public:
+    enum Category
+    {
+        PARSE_ERROR,
+        UNKNOWN_CUSTOMER,
+        UNKNOWN_TITLE,
+        CATEGORY_COUNT
+    };
+
+    // A range smaller than this is not worth a thread of its own.
+    static const size_t MIN_RANGE_BYTES = 1 << 20;
+
+    CommandValidator(Inventory &inventory, CustomerHashTable &customers);
+
+    // --------------------------------------------------- validate ---------------------------------------------------
+    // Description: Check every line of commandsFile on up to 'threads' workers (0 = hardware concurrency).
+    // Returns    : false if the file cannot be opened (already reported).
+    bool validate(const std::string &commandsFile, unsigned threads);
+
+    // ---------------------------------------------------- report ----------------------------------------------------
+    // Description: Print each problem in line order, then the line/command totals and the count per category.
+    void report(std::ostream &out) const;
+
+    size_t getProblemCount() const;
+    size_t getRangeCount()   const;
+
+private:
+    struct Problem
+    {
+        int         lineNo;     // within its range until validate() merges the ranges
+        Category    category;
+        std::string detail;
+        std::string line;
+    };
+
+    struct Range
+    {
+        std::streamoff       begin    = 0;
+        std::streamoff       end      = 0;
+        int                  lines    = 0;
+        int                  commands = 0;   // non-blank lines
+        bool                 opened   = true;
+        std::vector<Problem> problems;
+    };
+
+    void check(Range &range, const std::string &commandsFile);
+
+    Inventory            &inventory;
+    CustomerHashTable    &customers;
+    std::vector<Range>    ranges;
+    std::vector<Problem>  problems;
+    int                   lines    = 0;
+    int                   commands = 0;
+    size_t                counts[CATEGORY_COUNT] = {};
+};
+
+#endif // COMMANDVALIDATOR_H
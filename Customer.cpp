@@ -7,55 +7,135 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "Customer.h"
+#include "Output.h"
 #include <iostream>
+#include <utility>    // std::move
+
+// Drop a reference to a history chain without recursing once per entry: each step only frees the head when we
+// held the last reference to it, and the next entry is kept alive by 'head' before the old one is destroyed.
+static void releaseHistory(std::shared_ptr<const Customer::HistoryEntry> &head)
+{
+    while (head && head.use_count() == 1)
+    {
+        std::shared_ptr<const Customer::HistoryEntry> prev = head->prev;
+        head = std::move(prev);
+    }
+    head.reset();
+}
 
 Customer::Customer(int id, const std::string &firstName, const std::string &lastName)
     : id(id),
       firstName(firstName),
-      lastName(lastName)
+      lastName(lastName),
+      historySize(0)
+{
+}
+
+Customer::~Customer()
+{
+    releaseHistory(history);
+}
+
+void* Customer::operator new(size_t size)
 {
+    void *p = ::operator new(size);
+    MemoryAccounting::add(MemCategory::CUSTOMERS, size);
+    return p;
 }
 
-Customer::~Customer() = default;
+void Customer::operator delete(void *p, size_t size)
+{
+    MemoryAccounting::sub(MemCategory::CUSTOMERS, size);
+    ::operator delete(p);
+}
 
 void Customer::addHistory(const std::string &transaction)
 {
-    history.push_back(transaction);
+    // Entry and control block share one counted allocation.
+    history = std::allocate_shared<const HistoryEntry>(CountingAllocator<HistoryEntry, MemCategory::HISTORY>(),
+                                                       HistoryEntry{HistoryText(transaction.begin(), transaction.end()), history});
+    ++historySize;
 }
 
 void Customer::displayHistory() const
 {
-    std::cout << "Customer " << id << " " << lastName << ", " << firstName << std::endl;
+    historySnapshot().display();
+}
+
+Customer::HistorySnapshot Customer::historySnapshot() const
+{
+    return HistorySnapshot(id, firstName, lastName, history, historySize);
+}
 
-    if (history.empty())
+// ------------------------------------------------ HistorySnapshot ---------------------------------------------------
+Customer::HistorySnapshot::HistorySnapshot(int id, const std::string &firstName, const std::string &lastName,
+                                           std::shared_ptr<const HistoryEntry> head, size_t size)
+    : id(id),
+      firstName(firstName),
+      lastName(lastName),
+      head(std::move(head)),
+      count(size)
+{
+}
+
+Customer::HistorySnapshot::~HistorySnapshot()
+{
+    releaseHistory(head);
+}
+
+void Customer::HistorySnapshot::display() const
+{
+    Output::out() << "Customer " << id << " " << lastName << ", " << firstName << std::endl;
+
+    if (!head)
     {
-        std::cout << "  (no transactions)" << std::endl;
+        Output::out() << "  (no transactions)" << std::endl;
         return;
     }
 
     // Print latest -> earliest
-    for (auto it = history.rbegin(); it != history.rend(); ++it)
+    for (const HistoryEntry *e = head.get(); e; e = e->prev.get())
     {
-        std::cout << "  " << *it << std::endl;
+        Output::out() << "  " << e->text << std::endl;
     }
 }
 
+size_t Customer::HistorySnapshot::size() const
+{
+    return count;
+}
+
+const Customer::HistoryEntry* Customer::HistorySnapshot::newest() const
+{
+    return head.get();
+}
+
 int Customer::getId() const
 {
     return id;
 }
 
-bool Customer::hasBorrowed(const std::string &movieKey) const
+const std::string& Customer::getFirstName() const
+{
+    return firstName;
+}
+
+const std::string& Customer::getLastName() const
+{
+    return lastName;
+}
+
+bool Customer::hasBorrowed(std::string_view movieKey) const
 {
     return borrowedMovies.count(movieKey) > 0;
 }
 
-void Customer::borrowMovie(const std::string &movieKey)
+void Customer::borrowMovie(std::string_view storedKey)
 {
-    borrowedMovies.insert(movieKey);
+    borrowedMovies.insert(storedKey);
 }
 
-bool Customer::returnMovie(const std::string &movieKey)
+bool Customer::returnMovie(std::string_view movieKey)
 {
     auto it = borrowedMovies.find(movieKey);
     if (it == borrowedMovies.end())
@@ -4,25 +4,75 @@
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
 // Purpose : Represents a store customer. Tracks ID, name, transaction history, and currently-borrowed items.
+// Notes   : History is an immutable newest-first linked list shared through shared_ptr. Appending never touches
+//           existing entries, so a HistorySnapshot taken in O(1) stays valid (and consistent) while new
+//           transactions are recorded; entries are reclaimed when the last snapshot referencing them is released.
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef CUSTOMER_H
 #define CUSTOMER_H
 
+#include "MemoryAccounting.h"   // borrowed-set / history / object accounting
+
+#include <cstddef>      // size_t
 #include <iostream>     // displayHistory()
-#include <set>          // borrowed set
+#include <memory>       // std::shared_ptr history entries
 #include <string>
-#include <vector>       // history list
+#include <string_view>  // borrowed keys (the inventory's stored keys)
+#include <unordered_set> // borrowed set
 
 class Customer
 {
 public:
+    // ----------------------------------------------- HistoryEntry ---------------------------------------------------
+    // Description: One immutable transaction line (owned by the entry, counted as history) plus a link to the
+    //              previous (older) entry.
+    using HistoryText = std::basic_string<char, std::char_traits<char>, CountingAllocator<char, MemCategory::HISTORY>>;
+    struct HistoryEntry
+    {
+        HistoryText                         text;
+        std::shared_ptr<const HistoryEntry> prev;
+    };
+
+    // ---------------------------------------------- HistorySnapshot -------------------------------------------------
+    // Description: Point-in-time view of a customer's identity and history; unaffected by later transactions.
+    class HistorySnapshot
+    {
+    public:
+        HistorySnapshot(int id, const std::string &firstName, const std::string &lastName,
+                        std::shared_ptr<const HistoryEntry> head, size_t size);
+        ~HistorySnapshot();
+
+        HistorySnapshot(const HistorySnapshot&) = default;
+        HistorySnapshot& operator=(const HistorySnapshot&) = default;
+
+        // Description: Prints customer line + transactions (newest first) or "(no transactions)".
+        void display() const;
+
+        size_t size() const;
+
+        // Description: Newest entry (walk ->prev for older ones), or nullptr if there are no transactions.
+        const HistoryEntry* newest() const;
+
+    private:
+        int                                 id;
+        std::string                         firstName;
+        std::string                         lastName;
+        std::shared_ptr<const HistoryEntry> head;
+        size_t                              count;
+    };
+
     // -------------------------------------------------- Customer ----------------------------------------------------
     Customer(int id, const std::string &firstName, const std::string &lastName);
 
     // ------------------------------------------------- ~Customer ----------------------------------------------------
     virtual ~Customer();
 
+    // -------------------------------------------- operator new/delete -----------------------------------------------
+    // Description: Attribute Customer objects to MemCategory::CUSTOMERS.
+    static void* operator new(size_t size);
+    static void  operator delete(void *p, size_t size);
+
     // ------------------------------------------------ addHistory ----------------------------------------------------
     // Description: Append a human-readable transaction line.
     void addHistory(const std::string &transaction);
@@ -31,20 +81,33 @@ public:
     // Description: Prints customer line + recent transactions (newest first) or "(no transactions)".
     void displayHistory() const;
 
+    // ---------------------------------------------- historySnapshot -------------------------------------------------
+    // Description: O(1) consistent view of the history as of now (shares entries; copies only the name fields).
+    HistorySnapshot historySnapshot() const;
+
     // --------------------------------------------------- getId ------------------------------------------------------
     int getId() const;
 
+    // ------------------------------------------------ name accessors ------------------------------------------------
+    const std::string& getFirstName() const;
+    const std::string& getLastName() const;
+
     // ---------------------------------------- borrow/return helpers -------------------------------------------------
-    bool hasBorrowed(const std::string &movieKey) const;
-    void borrowMovie(const std::string &movieKey);
-    bool returnMovie(const std::string &movieKey);
+    // Description: borrowMovie keeps the view, so it must be the inventory's stored key (Inventory::getKey), which
+    //              lives as long as the inventory.
+    bool hasBorrowed(std::string_view movieKey) const;
+    void borrowMovie(std::string_view storedKey);
+    bool returnMovie(std::string_view movieKey);
 
 private:
-    int                      id;
-    std::string              firstName;
-    std::string              lastName;
-    std::vector<std::string> history;        // append oldest->newest, print newest-first
-    std::set<std::string>    borrowedMovies; // outstanding borrow set
+    int                                 id;
+    std::string                         firstName;
+    std::string                         lastName;
+    std::shared_ptr<const HistoryEntry> history;        // newest entry; ->prev walks toward the oldest
+    size_t                              historySize;
+    // outstanding borrow set: views of the inventory's stored keys
+    std::unordered_set<std::string_view, std::hash<std::string_view>, std::equal_to<std::string_view>,
+                       CountingAllocator<std::string_view, MemCategory::BORROWED>> borrowedMovies;
 };
 
 #endif // CUSTOMER_H
\ No newline at end of file
@@ -7,17 +7,117 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "CustomerHashTable.h"
+#include "Output.h"
+#include "LineScanner.h"
+#include <fstream>   // std::ifstream
+#include <algorithm> // std::sort
 #include <utility>
+#include <cerrno>    // strtol range errors
+#include <climits>   // INT_MIN / INT_MAX
+#include <cstdlib>   // std::strtol
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// Whole token is an optionally signed decimal that fits an int.
+static bool isInteger(std::string_view token)
+{
+    const std::string s(token);
+    char *end = nullptr;
+    errno = 0;
+    const long v = std::strtol(s.c_str(), &end, 10);
+    return !s.empty() && *end == '\0' && errno == 0 && v >= INT_MIN && v <= INT_MAX;
+}
 
 void CustomerHashTable::addCustomer(int customerID, Customer* customer)
 {
-    table[customerID] = customer;
+    Customer *&slot = table[customerID];
+    if (slot && slot != customer)
+    {
+        nameIndex.remove(slot);
+        delete slot;
+    }
+    slot = customer;
+    nameIndex.add(customer);
+
+    idFilter.add(BloomFilter::hash(static_cast<uint64_t>(customerID)));
+    if (idFilter.needsGrowth())
+    {
+        idFilter.reset(table.size() * 2);
+        for (const auto &kv : table) idFilter.add(BloomFilter::hash(static_cast<uint64_t>(kv.first)));
+    }
 }
 
 Customer* CustomerHashTable::getCustomer(int customerID)
 {
+    if (!idFilter.mayContain(BloomFilter::hash(static_cast<uint64_t>(customerID)))) return nullptr;
+
     auto it = table.find(customerID);
-    return (it == table.end()) ? nullptr : it->second;
+    if (it == table.end())
+    {
+        idFilter.noteFalsePositive();
+        return nullptr;
+    }
+    return it->second;
+}
+
+const BloomFilter& CustomerHashTable::getIdFilter() const
+{
+    return idFilter;
+}
+
+const CustomerNameIndex& CustomerHashTable::getNameIndex() const
+{
+    return nameIndex;
+}
+
+std::vector<int> CustomerHashTable::getIds() const
+{
+    std::vector<int> ids;
+    ids.reserve(table.size());
+    for (const auto &kv : table)
+    {
+        ids.push_back(kv.first);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+size_t CustomerHashTable::size() const
+{
+    return table.size();
+}
+
+bool CustomerHashTable::loadCustomers(const std::string &filename)
+{
+    std::ifstream fin(filename);
+    if (!fin)
+    {
+        Output::err() << "ERROR: cannot open customers file: " << filename << std::endl;
+        return false;
+    }
+
+    // Records are "id last first" read as a whitespace token stream (a record may span lines, as with >>);
+    // loading stops at the first id that is not an integer.
+    LineReader reader;
+    reader.attach(fin);
+    std::string_view line;
+    std::vector<std::string_view> tokens;
+    std::vector<std::string> record;
+    while (reader.next(line))
+    {
+        tokens.clear();
+        LineScanner::tokens(line, tokens);
+        for (std::string_view token : tokens)
+        {
+            record.emplace_back(token);
+            if (record.size() == 1 && !isInteger(token)) return true;
+            if (record.size() < 3) continue;
+
+            const int id = std::stoi(record[0]);
+            addCustomer(id, new Customer(id, record[2], record[1]));
+            record.clear();
+        }
+    }
+    return true;
 }
 
 CustomerHashTable::~CustomerHashTable()
@@ -4,31 +4,60 @@
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
 // Purpose : Lightweight hash table wrapper for Customer* keyed by ID. Owns Customer objects.
+//           A Bloom filter over the ids rejects unknown customers before the table is probed, and a name index
+//           (CustomerNameIndex) finds ids by surname or full name.
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef CUSTOMERHASHTABLE_H
 #define CUSTOMERHASHTABLE_H
 
 #include "Customer.h"
+#include "MemoryAccounting.h"  // bucket/node accounting
+#include "BloomFilter.h"       // unknown-id rejection
+#include "CustomerNameIndex.h" // lookup by name
+#include <string>          // customers filename
 #include <unordered_map>   // hash table for id -> Customer*
+#include <vector>          // id listing
 
 class CustomerHashTable
 {
 public:
     // ------------------------------------------------ addCustomer ---------------------------------------------------
-    // Description: Insert or replace an entry for id. Takes ownership of pointer.
+    // Description: Insert or replace an entry for id (a replaced customer is deleted). Takes ownership of pointer.
     void addCustomer(int customerID, Customer* customer);
 
     // ------------------------------------------------ getCustomer ---------------------------------------------------
-    // Description: Lookup by id; returns nullptr if not found (no ownership transfer).
+    // Description: Lookup by id; returns nullptr if not found (no ownership transfer). Ids the filter has never
+    //              seen are rejected without touching the table.
     Customer* getCustomer(int customerID);
 
+    // ----------------------------------------------- getIdFilter ----------------------------------------------------
+    const BloomFilter& getIdFilter() const;
+
+    // ---------------------------------------------- getNameIndex ----------------------------------------------------
+    const CustomerNameIndex& getNameIndex() const;
+
+    // -------------------------------------------------- getIds ------------------------------------------------------
+    // Description: Every customer id, ascending (stable order for reports and exports).
+    std::vector<int> getIds() const;
+
+    // --------------------------------------------------- size -------------------------------------------------------
+    size_t size() const;
+
+    // ----------------------------------------------- loadCustomers --------------------------------------------------
+    // Description: Load "id last first" records from a customers file.
+    // Returns    : false (with an error message) if the file cannot be opened.
+    bool loadCustomers(const std::string &filename);
+
     // -------------------------------------------------- ~CustomerHashTable -----------------------------------------
     // Description: Deletes all owned Customer*.
     ~CustomerHashTable();
 
 private:
-    std::unordered_map<int, Customer*> table;
+    std::unordered_map<int, Customer*, std::hash<int>, std::equal_to<int>,
+                       CountingAllocator<std::pair<const int, Customer*>, MemCategory::CUSTOMER_TABLE>> table;
+    BloomFilter       idFilter;    // every id in table
+    CustomerNameIndex nameIndex;   // every customer in table, by name
 };
 
 #endif // CUSTOMERHASHTABLE_H
\ No newline at end of file
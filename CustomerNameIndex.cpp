@@ -0,0 +1,86 @@
+// ---------------------------------------------- CustomerNameIndex.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Case-insensitive ordered (last, first, id) index over customers (see CustomerNameIndex.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "CustomerNameIndex.h"
+
+#include <climits>   // INT_MIN
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline int fold(char c)
+{
+    const unsigned char u = static_cast<unsigned char>(c);
+    return (u >= 'A' && u <= 'Z') ? u + ('a' - 'A') : u;
+}
+
+// <0, 0, >0 like strcmp, comparing ASCII-lower-cased bytes.
+static int compareNoCase(std::string_view a, std::string_view b)
+{
+    const size_t n = a.size() < b.size() ? a.size() : b.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const int ca = fold(a[i]);
+        const int cb = fold(b[i]);
+        if (ca != cb) return ca - cb;
+    }
+    return a.size() < b.size() ? -1 : (a.size() > b.size() ? 1 : 0);
+}
+
+static bool startsWithNoCase(std::string_view text, std::string_view prefix)
+{
+    return text.size() >= prefix.size() && compareNoCase(text.substr(0, prefix.size()), prefix) == 0;
+}
+
+bool CustomerNameIndex::Less::operator()(const Entry &a, const Entry &b) const
+{
+    if (const int c = compareNoCase(a.last, b.last))   return c < 0;
+    if (const int c = compareNoCase(a.first, b.first)) return c < 0;
+    return a.id < b.id;
+}
+
+// -------------------------------------------------- add / remove ----------------------------------------------------
+void CustomerNameIndex::add(const Customer *customer)
+{
+    entries.insert(Entry{customer->getLastName(), customer->getFirstName(), customer->getId()});
+}
+
+void CustomerNameIndex::remove(const Customer *customer)
+{
+    entries.erase(Entry{customer->getLastName(), customer->getFirstName(), customer->getId()});
+}
+
+// ----------------------------------------------------- lookups ------------------------------------------------------
+std::vector<int> CustomerNameIndex::findName(std::string_view last, std::string_view first, size_t limit) const
+{
+    std::vector<int> ids;
+    for (auto it = entries.lower_bound(Entry{last, first, INT_MIN});
+         it != entries.end() && ids.size() < limit; ++it)
+    {
+        if (compareNoCase(it->last, last) != 0 || compareNoCase(it->first, first) != 0) break;
+        ids.push_back(it->id);
+    }
+    return ids;
+}
+
+std::vector<int> CustomerNameIndex::findPrefix(std::string_view prefix, size_t limit) const
+{
+    // ("prefix", "", INT_MIN) sorts before every entry whose surname starts with prefix, and those entries are
+    // contiguous from there.
+    std::vector<int> ids;
+    for (auto it = entries.lower_bound(Entry{prefix, std::string_view(), INT_MIN});
+         it != entries.end() && ids.size() < limit; ++it)
+    {
+        if (!startsWithNoCase(it->last, prefix)) break;
+        ids.push_back(it->id);
+    }
+    return ids;
+}
+
+size_t CustomerNameIndex::size() const
+{
+    return entries.size();
+}
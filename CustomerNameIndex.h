@@ -0,0 +1,60 @@
+// ----------------------------------------------- CustomerNameIndex.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Secondary index of customers by (last name, first name), maintained by CustomerHashTable as customers are
+//          added or replaced, for counter lookups by surname.
+// Notes  : - An ordered set of (last, first, id) entries compared case-insensitively (ASCII). All surnames sharing a
+//            prefix are contiguous in that order, so both an exact-name and a surname-prefix lookup are one
+//            O(log n) descent followed by a walk over the k matches.
+//          - Entries view the names stored in the Customer objects (no copies); the owning table removes an entry
+//            before it deletes or replaces its customer.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef CUSTOMERNAMEINDEX_H
+#define CUSTOMERNAMEINDEX_H
+
+#include "Customer.h"
+#include "MemoryAccounting.h"   // node accounting
+#include <cstddef>              // size_t
+#include <set>
+#include <string_view>
+#include <vector>
+
+class CustomerNameIndex
+{
+public:
+    // ---------------------------------------------------- add / remove ----------------------------------------------
+    void add(const Customer *customer);
+    void remove(const Customer *customer);
+
+    // ---------------------------------------------------- findName --------------------------------------------------
+    // Description: Ids of customers named exactly (last, first), ignoring case, in id order; at most 'limit'.
+    std::vector<int> findName(std::string_view last, std::string_view first, size_t limit) const;
+
+    // --------------------------------------------------- findPrefix -------------------------------------------------
+    // Description: Ids of customers whose surname starts with prefix, ignoring case, ordered by (last, first, id);
+    //              at most 'limit'.
+    std::vector<int> findPrefix(std::string_view prefix, size_t limit) const;
+
+    // ------------------------------------------------------ size ----------------------------------------------------
+    size_t size() const;
+
+private:
+    struct Entry
+    {
+        std::string_view last;
+        std::string_view first;
+        int              id;
+    };
+
+    struct Less
+    {
+        bool operator()(const Entry &a, const Entry &b) const;
+    };
+
+    std::set<Entry, Less, CountingAllocator<Entry, MemCategory::NAME_INDEX>> entries;
+};
+
+#endif // CUSTOMERNAMEINDEX_H
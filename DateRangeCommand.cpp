@@ -0,0 +1,27 @@
+// ----------------------------------------------- DateRangeCommand.cpp -----------------------------------------------
+// Prints Classics in a release-date range via ClassicsIndex (binary search + contiguous scan).
+
+#include "DateRangeCommand.h"
+#include "Inventory.h"
+#include "Output.h"
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+void DateRangeCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    const std::vector<const Movie*> movies = inventory.getClassicsIndex().range(fromYear, fromMonth, toYear, toMonth);
+
+    Output::out() << "Classics " << fromYear << "-" << std::setw(2) << std::setfill('0') << fromMonth
+                  << " to " << toYear << "-" << std::setw(2) << toMonth << std::setfill(' ') << ":" << std::endl;
+    if (movies.empty())
+    {
+        Output::out() << "  (no matches)" << std::endl;
+        return;
+    }
+    for (const Movie *m : movies)
+    {
+        Output::out() << "  ";
+        m->display();
+    }
+}
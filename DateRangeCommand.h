@@ -0,0 +1,40 @@
+// ------------------------------------------------ DateRangeCommand.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that lists Classics released within a date range, from the inventory's packed-date index.
+//          Line format: "Y <from> <to>" where each bound is "YYYY" or "YYYY-MM" (inclusive; a bare year spans
+//          January for the lower bound and December for the upper bound).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef DATERANGECOMMAND_H
+#define DATERANGECOMMAND_H
+
+#include "Command.h"
+
+class DateRangeCommand : public Command
+{
+public:
+    DateRangeCommand(int fromYear, int fromMonth, int toYear, int toMonth)
+        : fromYear(fromYear),
+          fromMonth(fromMonth),
+          toYear(toYear),
+          toMonth(toMonth)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints a heading, then the matching Classics in display order, or "  (no matches)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    int fromYear;
+    int fromMonth;
+    int toYear;
+    int toMonth;
+};
+
+#endif // DATERANGECOMMAND_H
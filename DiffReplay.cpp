@@ -0,0 +1,634 @@
+// -------------------------------------------------- DiffReplay.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Differential replay harness. Runs a reference and a candidate build of movies_tester on the same seeded,
+//           generated command workloads and compares stdout, stderr and the completed log byte for byte. A
+//           diverging workload is reduced with delta debugging (ddmin) to a small reproducer command file. Wall
+//           time of both engines is summed over all workloads and reported as a speedup.
+// Usage   : ./diff_replay <referenceBin> <candidateBin> [--seeds N] [--first-seed S] [--commands N]
+//                         [--movies file] [--customers file] [--work dir]
+//           Defaults: 20 seeds from 1, 2000 commands each, data4movies.txt, data4customers.txt, ./diff_replay.work
+//           Exit status is 0 when every workload matched, 1 on any divergence, 2 on usage/setup errors.
+// Notes   : - Excluded from the comparison, because engine variants are expected to differ there: the
+//             "[info] Startup:" timing line and "[info] Memory:" footprint report on stderr, and the detail lines
+//             under the M (memory) and V (lookup stats) headers on stdout. The headers themselves are compared.
+//           - Both engines run with the same relative file names from sibling directories, so the echoed paths in
+//             the first stderr line are identical. Each workload comes with its own reload delta file (delta.txt),
+//             and the file written by E (export.col) is compared as a fourth output.
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>    // std::min, std::max
+#include <chrono>       // engine wall time
+#include <cstdint>
+#include <cstdlib>      // std::stoi
+#include <filesystem>
+#include <fstream>
+#include <iomanip>      // speedup precision
+#include <iostream>
+#include <random>       // std::mt19937 workload generator
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>      // open
+#include <sys/wait.h>   // waitpid
+#include <unistd.h>     // fork, execv, dup2, chdir
+
+namespace fs = std::filesystem;
+
+// One catalog title as a command descriptor, e.g. {'F', "Fargo, 1996"} or {'C', "3 1971 Ruth Gordon"}.
+struct Title
+{
+    char        genre;
+    std::string descriptor;
+};
+
+// Captured result of one engine run.
+struct RunResult
+{
+    std::string out;
+    std::string err;
+    std::string completed;
+    std::string exported;   // export.col written by E, empty if none
+    int         status = 0;
+    double      ms     = 0.0;
+};
+
+// Which stream diverged first and where.
+struct Divergence
+{
+    std::string stream;   // "stdout", "stderr", "completed log", "export file", "exit status" or "" when identical
+    int         line = 0;
+    std::string reference;
+    std::string candidate;
+};
+
+// ----------------------------------------------------- helpers ------------------------------------------------------
+static std::string trim(const std::string &s)
+{
+    const size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    const size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+static std::vector<std::string> splitComma(const std::string &line)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream ss(line);
+    while (std::getline(ss, field, ',')) fields.push_back(trim(field));
+    return fields;
+}
+
+static std::string readFile(const fs::path &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+static void writeLines(const fs::path &path, const std::vector<std::string> &lines)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (const std::string &l : lines) out << l << "\n";
+}
+
+// Drops the "[info] Startup:" timing line and the "[info] Memory:" report, which differ between engine variants.
+static std::string stripTiming(const std::string &err)
+{
+    std::string kept, line;
+    std::istringstream in(err);
+    while (std::getline(in, line))
+    {
+        if (line.rfind("[info] Startup:", 0) == 0 || line.rfind("[info] Memory:", 0) == 0) continue;
+        kept += line;
+        kept += '\n';
+    }
+    return kept;
+}
+
+// Drops the indented detail lines under the M and V headers: byte counts and probe/cache counters are engine
+// specific, while the headers still show where each command ran.
+static std::string stripEngineStats(const std::string &out)
+{
+    std::string kept, line;
+    std::istringstream in(out);
+    bool inStats = false;
+    while (std::getline(in, line))
+    {
+        if (inStats && line.rfind("  ", 0) == 0) continue;
+        inStats = line == "=== Memory (process-wide) ===" || line == "=== Lookup stats ===";
+        kept += line;
+        kept += '\n';
+    }
+    return kept;
+}
+
+// ---------------------------------------------------- loadTitles ----------------------------------------------------
+// Description: Turns one movies-file line into a borrow/return descriptor, following its genre's KeyShape.
+// Returns    : false for lines that are not a well-formed title.
+// --------------------------------------------------------------------------------------------------------------------
+static bool titleFromLine(const std::string &line, Title &out)
+{
+    const std::vector<std::string> f = splitComma(line);
+    if (f.size() < 5 || f[0].size() != 1) return false;
+    const char genre = f[0][0];
+    const std::string &director = f[2], &title = f[3], &tail = f[4];
+
+    if (genre == 'F' || genre == 'N')        // TITLE_YEAR: "Title, Year"
+    {
+        out = {genre, title + ", " + tail};
+        return true;
+    }
+    if (genre == 'D' || genre == 'W')        // DIRECTOR_TITLE: "Director, Title,"
+    {
+        out = {genre, director + ", " + title + ","};
+        return true;
+    }
+    if (genre == 'C')                        // DATE_ACTOR: tail "First Last Month Year" -> "Month Year First Last"
+    {
+        std::istringstream ts(tail);
+        std::string first, last;
+        int month = 0, year = 0;
+        if (!(ts >> first >> last >> month >> year)) return false;
+        out = {genre, std::to_string(month) + " " + std::to_string(year) + " " + first + " " + last};
+        return true;
+    }
+    return false;
+}
+
+static std::vector<Title> loadTitles(const std::string &moviesFile)
+{
+    std::vector<Title> titles;
+    std::ifstream in(moviesFile);
+    std::string line;
+    Title t;
+    while (std::getline(in, line))
+    {
+        if (titleFromLine(line, t)) titles.push_back(t);
+    }
+    return titles;
+}
+
+// ------------------------------------------------- loadCustomers ----------------------------------------------------
+// Customers file lines are "<id> <last> <first>".
+struct CustomerName
+{
+    int         id;
+    std::string last;
+    std::string first;
+};
+
+static std::vector<CustomerName> loadCustomers(const std::string &customersFile)
+{
+    std::vector<CustomerName> customers;
+    std::ifstream in(customersFile);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream ls(line);
+        CustomerName c;
+        if (ls >> c.id >> c.last >> c.first) customers.push_back(c);
+    }
+    return customers;
+}
+
+// -------------------------------------------------- generateDelta ---------------------------------------------------
+// Description: Seeded reload delta (movies-file format) for the workload's L lines: new titles of every genre, more
+//              copies of known titles, one duplicate row and one malformed row.
+// --------------------------------------------------------------------------------------------------------------------
+static std::vector<std::string> generateDelta(uint32_t seed, const std::vector<std::string> &catalog)
+{
+    static const char *const NAMES[] = {"Ada Lane", "Bo Reyes", "Cy Moreau", "Di Okafor", "Ed Lindqvist"};
+
+    std::mt19937 rng(seed ^ 0x9e3779b9u);
+    auto pick = [&](size_t n) { return static_cast<size_t>(rng() % n); };
+
+    std::vector<std::string> lines;
+    for (int i = 0; i < 12; ++i)
+    {
+        const std::string director = NAMES[pick(5)];
+        const std::string title    = "Reel " + std::to_string(seed) + "-" + std::to_string(i);
+        const int         stock    = static_cast<int>(1 + pick(5));
+        const int         year     = static_cast<int>(1930 + pick(90));
+        std::ostringstream l;
+        switch (i % 5)
+        {
+        case 0:  l << "F, " << stock << ", " << director << ", " << title << ", " << year;                    break;
+        case 1:  l << "D, " << stock << ", " << director << ", " << title << ", " << year;                    break;
+        case 2:  l << "C, " << stock << ", " << director << ", " << title << ", " << NAMES[pick(5)] << " "
+                   << (1 + pick(12)) << " " << year;                                                          break;
+        case 3:  l << "N, " << stock << ", " << director << ", " << title << ", " << year;                    break;
+        default: l << "W, " << stock << ", " << director << ", " << title << ", Danish " << year;             break;
+        }
+        lines.push_back(l.str());
+    }
+    lines.push_back(lines[pick(lines.size())]);   // same title twice: restocks its own addition
+
+    for (int i = 0; i < 4 && !catalog.empty(); ++i)
+    {
+        const std::vector<std::string> f = splitComma(catalog[pick(catalog.size())]);
+        if (f.size() < 5) continue;
+        lines.push_back(f[0] + ", " + std::to_string(1 + pick(3)) + ", " + f[2] + ", " + f[3] + ", " + f[4]);
+    }
+    lines.push_back("Z, 3, Nobody, Not A Genre, 2001");
+    return lines;
+}
+
+// ------------------------------------------------- generateWorkload -------------------------------------------------
+// Description: Seeded command mix: mostly borrows and returns of real titles (returns favor recent borrows so they
+//              usually succeed), queries of every read-only command, restocks, a few reloads of delta.txt and
+//              exports to export.col, and ~5% malformed or failing lines. titles includes the delta's new titles,
+//              so they are borrowed both before (unknown) and after the reload merges them.
+// --------------------------------------------------------------------------------------------------------------------
+static std::vector<std::string> generateWorkload(uint32_t seed, int count, const std::vector<Title> &titles,
+                                                 const std::vector<CustomerName> &customers)
+{
+    static const char *const GENRES  = "FDCNW";
+    static const char *const WORDS[] = {"the", "of", "Harry", "Sally", "Lambs", "Wonderful", "zzz", "a"};
+
+    std::mt19937 rng(seed);
+    auto pick = [&](size_t n) { return static_cast<size_t>(rng() % n); };
+
+    std::vector<std::pair<int, const Title*>> loans;   // borrows not yet returned by the workload
+    std::vector<std::string> lines;
+    lines.reserve(static_cast<size_t>(count));
+
+    for (int i = 0; i < count; ++i)
+    {
+        const int roll = static_cast<int>(pick(100));
+        const CustomerName &who = customers[pick(customers.size())];
+        const int cust = who.id;
+        const Title &t = titles[pick(titles.size())];
+        std::ostringstream l;
+
+        if (roll < 36)
+        {
+            l << "B " << cust << " D " << t.genre << " " << t.descriptor;
+            loans.emplace_back(cust, &t);
+        }
+        else if (roll < 61)
+        {
+            if (!loans.empty() && pick(4) != 0)
+            {
+                const size_t k = loans.size() - 1 - pick(std::min<size_t>(loans.size(), 8));
+                l << "R " << loans[k].first << " D " << loans[k].second->genre << " "
+                  << loans[k].second->descriptor;
+                loans.erase(loans.begin() + static_cast<std::ptrdiff_t>(k));
+            }
+            else
+            {
+                l << "R " << cust << " D " << t.genre << " " << t.descriptor;
+            }
+        }
+        else if (roll < 64) l << "I";
+        else if (roll < 68) l << "H " << cust;
+        else if (roll < 71) l << "S " << WORDS[pick(8)];
+        else if (roll < 74) l << "P " << (1 + pick(5)) << " " << std::string(WORDS[pick(8)]).substr(0, 1 + pick(3));
+        else if (roll < 76) l << "T " << GENRES[pick(5)] << " " << (1 + pick(5));
+        else if (roll < 79) l << (pick(2) ? "O" : "O " + std::to_string(cust));
+        else if (roll < 81) l << "Y " << (1930 + pick(20)) << " " << (1940 + pick(40)) << "-" << (1 + pick(12));
+        else if (roll < 83) l << "G " << GENRES[pick(5)] << " " << (1 + pick(4));
+        else if (roll < 85)
+        {
+            if (pick(2)) l << "N " << (1 + pick(5)) << " " << who.last.substr(0, 1 + pick(who.last.size()));
+            else         l << "N " << (1 + pick(3)) << " " << who.last << " " << who.first;
+        }
+        else if (roll < 88) l << "A D " << t.genre << " " << t.descriptor;
+        else if (roll < 91)
+        {
+            const Title &u = titles[pick(titles.size())];
+            l << "U +" << (1 + pick(4)) << " D " << t.genre << " " << t.descriptor << "; -" << (1 + pick(2))
+              << " D " << u.genre << " " << u.descriptor;
+        }
+        else if (roll < 92) l << "L delta.txt";
+        else if (roll < 93) l << "E export.col";
+        else if (roll < 94) l << "M";
+        else if (roll < 95) l << "V";
+        else
+        {
+            switch (pick(5))
+            {
+            case 0:  l << "X";                                                                        break;
+            case 1:  l << "B " << cust << " D Z " << t.descriptor;                                   break;
+            case 2:  l << "B 1234 D " << t.genre << " " << t.descriptor;                             break;
+            case 3:  l << "B " << cust << " Z " << t.genre << " " << t.descriptor;                   break;
+            default: l << "B " << cust << " D F Bogus Title, " << (1900 + pick(100));                break;
+            }
+        }
+        lines.push_back(l.str());
+    }
+    return lines;
+}
+
+// ---------------------------------------------------- runEngine -----------------------------------------------------
+// Description: Runs bin from dir as "bin movies.txt customers.txt commands.txt completed.txt" and captures the
+//              three outputs plus the export file. Returns false if the process could not be started.
+// --------------------------------------------------------------------------------------------------------------------
+static bool runEngine(const std::string &bin, const fs::path &dir, RunResult &result)
+{
+    const fs::path outPath = dir / "stdout.txt", errPath = dir / "stderr.txt", logPath = dir / "completed.txt";
+    const fs::path exportPath = dir / "export.col";
+    fs::remove(logPath);
+    fs::remove(exportPath);
+
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0)
+    {
+        const int out = open(outPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        const int err = open(errPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (out < 0 || err < 0 || chdir(dir.c_str()) != 0) _exit(127);
+        dup2(out, STDOUT_FILENO);
+        dup2(err, STDERR_FILENO);
+        close(out);
+        close(err);
+        execl(bin.c_str(), bin.c_str(), "movies.txt", "customers.txt", "commands.txt", "completed.txt",
+              static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    result.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 127) return false;
+
+    result.status    = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    result.out       = stripEngineStats(readFile(outPath));
+    result.err       = stripTiming(readFile(errPath));
+    result.completed = readFile(logPath);
+    result.exported  = readFile(exportPath);
+    return true;
+}
+
+// ----------------------------------------------------- compare ------------------------------------------------------
+// Description: First differing line across stdout, stderr, the completed log, the export file and the exit status.
+// --------------------------------------------------------------------------------------------------------------------
+static Divergence firstDifference(const std::string &stream, const std::string &a, const std::string &b)
+{
+    Divergence d;
+    if (a == b) return d;
+
+    std::istringstream as(a), bs(b);
+    std::string la, lb;
+    int line = 0;
+    while (true)
+    {
+        ++line;
+        const bool ha = static_cast<bool>(std::getline(as, la));
+        const bool hb = static_cast<bool>(std::getline(bs, lb));
+        if (!ha && !hb) break;   // same lines, differing only in a trailing newline
+        if (ha != hb || la != lb)
+        {
+            d.reference = ha ? la : "(end of output)";
+            d.candidate = hb ? lb : "(end of output)";
+            break;
+        }
+    }
+    d.stream = stream;
+    d.line   = line;
+    return d;
+}
+
+static Divergence compare(const RunResult &ref, const RunResult &cand)
+{
+    Divergence d = firstDifference("stdout", ref.out, cand.out);
+    if (d.stream.empty()) d = firstDifference("stderr", ref.err, cand.err);
+    if (d.stream.empty()) d = firstDifference("completed log", ref.completed, cand.completed);
+    if (d.stream.empty() && ref.exported != cand.exported)
+    {
+        d.stream    = "export file";   // binary: no line number
+        d.reference = std::to_string(ref.exported.size()) + " bytes";
+        d.candidate = std::to_string(cand.exported.size()) + " bytes";
+    }
+    if (d.stream.empty() && ref.status != cand.status)
+    {
+        d.stream    = "exit status";
+        d.reference = std::to_string(ref.status);
+        d.candidate = std::to_string(cand.status);
+    }
+    return d;
+}
+
+// ---------------------------------------------------- DiffRunner ----------------------------------------------------
+// Runs both engines on one command list in work/ref and work/cand.
+// --------------------------------------------------------------------------------------------------------------------
+class DiffRunner
+{
+public:
+    DiffRunner(const std::string &reference, const std::string &candidate, const fs::path &work)
+        : reference(reference), candidate(candidate), refDir(work / "ref"), candDir(work / "cand")
+    {
+    }
+
+    // Description: Writes the reload delta read by the workload's L lines; it stays fixed while a workload is
+    //              minimized.
+    void setDelta(const std::vector<std::string> &lines)
+    {
+        writeLines(refDir / "delta.txt", lines);
+        writeLines(candDir / "delta.txt", lines);
+    }
+
+    // Description: Returns false if either engine could not be started (reported on stderr).
+    bool run(const std::vector<std::string> &commands, Divergence &diff, double *refMs = nullptr,
+             double *candMs = nullptr)
+    {
+        writeLines(refDir / "commands.txt", commands);
+        writeLines(candDir / "commands.txt", commands);
+
+        RunResult ref, cand;
+        if (!runEngine(reference, refDir, ref) || !runEngine(candidate, candDir, cand))
+        {
+            std::cerr << "ERROR: cannot run engine: " << reference << " / " << candidate << std::endl;
+            return false;
+        }
+        if (refMs)  *refMs  += ref.ms;
+        if (candMs) *candMs += cand.ms;
+        diff = compare(ref, cand);
+        return true;
+    }
+
+    // Description: Same as run() but only reports whether the outputs diverge.
+    bool diverges(const std::vector<std::string> &commands)
+    {
+        Divergence d;
+        return run(commands, d) && !d.stream.empty();
+    }
+
+private:
+    std::string reference;
+    std::string candidate;
+    fs::path    refDir;
+    fs::path    candDir;
+};
+
+// ----------------------------------------------------- minimize -----------------------------------------------------
+// Description: ddmin over command lines: the smallest subsequence (1-minimal) that still diverges.
+// --------------------------------------------------------------------------------------------------------------------
+static std::vector<std::string> minimize(std::vector<std::string> lines, DiffRunner &runner)
+{
+    size_t parts = 2;
+    while (lines.size() >= 2)
+    {
+        const size_t chunk = (lines.size() + parts - 1) / parts;
+        bool reduced = false;
+
+        // Try each chunk alone, then each complement.
+        for (size_t start = 0; start < lines.size() && !reduced; start += chunk)
+        {
+            const size_t end = std::min(lines.size(), start + chunk);
+            std::vector<std::string> subset(lines.begin() + static_cast<std::ptrdiff_t>(start),
+                                            lines.begin() + static_cast<std::ptrdiff_t>(end));
+            if (runner.diverges(subset))
+            {
+                lines   = std::move(subset);
+                parts   = 2;
+                reduced = true;
+            }
+        }
+        for (size_t start = 0; start < lines.size() && !reduced && parts > 2; start += chunk)
+        {
+            const size_t end = std::min(lines.size(), start + chunk);
+            std::vector<std::string> complement(lines.begin(), lines.begin() + static_cast<std::ptrdiff_t>(start));
+            complement.insert(complement.end(), lines.begin() + static_cast<std::ptrdiff_t>(end), lines.end());
+            if (runner.diverges(complement))
+            {
+                lines   = std::move(complement);
+                parts   = std::max<size_t>(parts - 1, 2);
+                reduced = true;
+            }
+        }
+
+        if (!reduced)
+        {
+            if (parts >= lines.size()) break;
+            parts = std::min(lines.size(), parts * 2);
+        }
+    }
+    return lines;
+}
+
+// ------------------------------------------------------- main -------------------------------------------------------
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <referenceBin> <candidateBin> [--seeds N] [--first-seed S]"
+                  << " [--commands N] [--movies file] [--customers file] [--work dir]" << std::endl;
+        return 2;
+    }
+
+    std::string moviesFile    = "data4movies.txt";
+    std::string customersFile = "data4customers.txt";
+    fs::path    work          = "diff_replay.work";
+    int         seeds         = 20;
+    uint32_t    firstSeed     = 1;
+    int         commands      = 2000;
+
+    for (int i = 3; i + 1 < argc; i += 2)
+    {
+        const std::string opt = argv[i], val = argv[i + 1];
+        if      (opt == "--seeds")      seeds         = std::stoi(val);
+        else if (opt == "--first-seed") firstSeed     = static_cast<uint32_t>(std::stoul(val));
+        else if (opt == "--commands")   commands      = std::stoi(val);
+        else if (opt == "--movies")     moviesFile    = val;
+        else if (opt == "--customers")  customersFile = val;
+        else if (opt == "--work")       work          = val;
+        else
+        {
+            std::cerr << "ERROR: unknown option " << opt << std::endl;
+            return 2;
+        }
+    }
+
+    std::error_code ec;
+    const std::string reference = fs::absolute(argv[1], ec).lexically_normal().string();
+    const std::string candidate = fs::absolute(argv[2], ec).lexically_normal().string();
+
+    const std::vector<Title>        titles    = loadTitles(moviesFile);
+    const std::vector<CustomerName> customers = loadCustomers(customersFile);
+    std::vector<std::string>        catalog;   // movies-file rows, restocked by the reload deltas
+    {
+        std::istringstream rows(readFile(moviesFile));
+        std::string row;
+        while (std::getline(rows, row)) catalog.push_back(row);
+    }
+    if (titles.empty() || customers.empty())
+    {
+        std::cerr << "ERROR: no titles or customers loaded from " << moviesFile << " / " << customersFile
+                  << std::endl;
+        return 2;
+    }
+
+    for (const char *side : {"ref", "cand"})
+    {
+        fs::create_directories(work / side, ec);
+        fs::copy_file(moviesFile, work / side / "movies.txt", fs::copy_options::overwrite_existing, ec);
+        fs::copy_file(customersFile, work / side / "customers.txt", fs::copy_options::overwrite_existing, ec);
+        if (ec)
+        {
+            std::cerr << "ERROR: cannot prepare work directory " << (work / side) << ": " << ec.message()
+                      << std::endl;
+            return 2;
+        }
+    }
+
+    std::cout << "Reference: " << reference << "\nCandidate: " << candidate << "\n"
+              << "Workloads: " << seeds << " x " << commands << " commands (seeds " << firstSeed << ".."
+              << (firstSeed + static_cast<uint32_t>(seeds) - 1) << ")\n";
+
+    DiffRunner runner(reference, candidate, work);
+    double refMs = 0.0, candMs = 0.0;
+    int matched = 0;
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (int s = 0; s < seeds; ++s)
+    {
+        const uint32_t seed = firstSeed + static_cast<uint32_t>(s);
+        const std::vector<std::string> delta = generateDelta(seed, catalog);
+        std::vector<Title> pool = titles;
+        Title added;
+        for (const std::string &row : delta)
+        {
+            if (titleFromLine(row, added)) pool.push_back(added);
+        }
+        runner.setDelta(delta);
+        const std::vector<std::string> workload = generateWorkload(seed, commands, pool, customers);
+
+        double r = 0.0, c = 0.0;
+        Divergence diff;
+        if (!runner.run(workload, diff, &r, &c)) return 2;
+        refMs  += r;
+        candMs += c;
+
+        std::cout << "seed " << seed << ": ref " << r << " ms | cand " << c << " ms | ";
+        if (diff.stream.empty())
+        {
+            std::cout << "identical" << std::endl;
+            ++matched;
+            continue;
+        }
+
+        std::cout << "DIVERGED in " << diff.stream;
+        if (diff.line > 0) std::cout << " at line " << diff.line;
+        std::cout << "\n  reference: " << diff.reference << "\n  candidate: " << diff.candidate << std::endl;
+
+        const std::vector<std::string> repro = minimize(workload, runner);
+        const fs::path reproFile = work / ("repro_seed" + std::to_string(seed) + ".txt");
+        writeLines(reproFile, repro);
+        runner.run(repro, diff);
+        std::cout << "  minimized " << workload.size() << " -> " << repro.size() << " commands: " << reproFile
+                  << "\n  reproducer diverges in " << diff.stream << ": '" << diff.reference << "' vs '"
+                  << diff.candidate << "'" << std::endl;
+    }
+
+    std::cout << "Result: " << matched << "/" << seeds << " workloads identical | reference " << refMs
+              << " ms | candidate " << candMs << " ms | speedup " << (candMs > 0.0 ? refMs / candMs : 0.0) << "x"
+              << std::endl;
+    return matched == seeds ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// ------------------------------------------------ ExportCommand.cpp -------------------------------------------------
+// Writes the movies / loans / history tables through ColumnarWriter; memory stays bounded by one chunk.
+
+#include "ExportCommand.h"
+#include "ColumnarFile.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "classics.h"
+#include "foreign.h"
+#include "Output.h"
+#include <fstream>
+#include <iostream>
+
+void ExportCommand::execute(Inventory &inventory, CustomerHashTable &customers) const
+{
+    std::ofstream fout(filename, std::ios::binary | std::ios::trunc);
+    if (!fout)
+    {
+        Output::err() << "ERROR: cannot open export file: " << filename << std::endl;
+        return;
+    }
+    ColumnarWriter writer(fout);
+
+    // movies: one row per title, in display order, with stock as of one snapshot
+    enum { M_CATEGORY, M_KEY, M_TITLE, M_DIRECTOR, M_YEAR, M_MONTH, M_ACTOR, M_LANGUAGE, M_STOCK, M_OUT };
+    writer.beginTable("movies", {
+        {"category", ColumnType::U8},  {"key", ColumnType::STR},      {"title", ColumnType::STR},
+        {"director", ColumnType::STR}, {"year", ColumnType::I32},     {"month", ColumnType::I32},
+        {"actor", ColumnType::STR},    {"language", ColumnType::STR}, {"stock", ColumnType::I32},
+        {"checked_out", ColumnType::I32}
+    });
+    const InventorySnapshot snap = inventory.snapshot();
+    size_t movieRows = 0;
+    for (const auto &section : snap.getCatalog())
+    {
+        for (const Movie *m : section.movies)
+        {
+            writer.set(M_CATEGORY, m->getCategory());
+            writer.set(M_KEY, m->buildKey());
+            writer.set(M_TITLE, m->getTitle());
+            writer.set(M_DIRECTOR, m->getDirector());
+            writer.set(M_YEAR, m->getYear());
+            if (const Classics *c = dynamic_cast<const Classics*>(m))
+            {
+                writer.set(M_MONTH, c->getReleaseMonth());
+                writer.set(M_ACTOR, std::string(c->getMajorActorFirst()) + " " + std::string(c->getMajorActorLast()));
+            }
+            if (const Foreign *f = dynamic_cast<const Foreign*>(m))
+            {
+                writer.set(M_LANGUAGE, f->getLanguage());
+            }
+            writer.set(M_STOCK, snap.stockOf(m));
+            writer.set(M_OUT, inventory.getCheckedOut(m));
+            writer.endRow();
+            ++movieRows;
+        }
+    }
+
+    const std::vector<int> ids = customers.getIds();
+
+    // loans: outstanding copies per (customer, title)
+    enum { L_CUSTOMER, L_CATEGORY, L_KEY, L_COPIES };
+    writer.beginTable("loans", {
+        {"customer_id", ColumnType::I32}, {"category", ColumnType::U8},
+        {"key", ColumnType::STR},         {"copies", ColumnType::I32}
+    });
+    size_t loanRows = 0;
+    for (int id : ids)
+    {
+        for (const auto &loan : inventory.getCustomerLoans(id))
+        {
+            writer.set(L_CUSTOMER, id);
+            writer.set(L_CATEGORY, loan.first->getCategory());
+            writer.set(L_KEY, loan.first->buildKey());
+            writer.set(L_COPIES, loan.second);
+            writer.endRow();
+            ++loanRows;
+        }
+    }
+
+    // history: every transaction line, newest first per customer, numbered from the oldest
+    enum { H_CUSTOMER, H_SEQ, H_TEXT };
+    writer.beginTable("history", {
+        {"customer_id", ColumnType::I32}, {"seq", ColumnType::I32}, {"text", ColumnType::STR}
+    });
+    size_t historyRows = 0;
+    for (int id : ids)
+    {
+        const Customer::HistorySnapshot hist = customers.getCustomer(id)->historySnapshot();
+        int seq = static_cast<int>(hist.size());
+        for (const Customer::HistoryEntry *e = hist.newest(); e; e = e->prev.get())
+        {
+            writer.set(H_CUSTOMER, id);
+            writer.set(H_SEQ, --seq);
+            writer.set(H_TEXT, e->text);
+            writer.endRow();
+            ++historyRows;
+        }
+    }
+
+    if (!writer.finish())
+    {
+        Output::err() << "ERROR: write failed for export file: " << filename << std::endl;
+        return;
+    }
+    Output::err() << "[info] Exported " << filename << ": " << movieRows << " movies, " << loanRows << " loans, "
+                  << historyRows << " history rows" << std::endl;
+}
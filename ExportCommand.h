@@ -0,0 +1,40 @@
+// ------------------------------------------------- ExportCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that streams inventory, loans and customer histories to a columnar binary file for analytics
+//          (format and reader in ColumnarFile.h). Line format: "E <file>".
+// Tables : movies  (category u8, key, title, director, actor, language: str; year, month, stock, checked_out: i32)
+//          loans   (customer_id i32, category u8, key str, copies i32)
+//          history (customer_id i32, seq i32 -- 0 = oldest, text str)
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef EXPORTCOMMAND_H
+#define EXPORTCOMMAND_H
+
+#include "Command.h"
+#include <string>
+
+class ExportCommand : public Command
+{
+public:
+    explicit ExportCommand(const std::string &filename)
+        : filename(filename)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: filename holds a consistent dump of the current state, written chunk by chunk; an "[info]" line with
+    //       row counts is printed, or an error if the file cannot be written.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+    bool writesFiles() const override { return true; }
+
+private:
+    std::string filename;
+};
+
+#endif // EXPORTCOMMAND_H
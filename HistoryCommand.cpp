@@ -1,9 +1,10 @@
 // ---------------------------------------------- HistoryCommand.cpp --------------------------------------------------
-// Prints a customer's transaction history.
+// Prints a customer's transaction history from an O(1) snapshot of it.
 
 #include "HistoryCommand.h"
 #include "CustomerHashTable.h"
 #include "Customer.h"
+#include "Output.h"
 #include <iostream>
 
 void HistoryCommand::execute(Inventory &, CustomerHashTable &customers) const
@@ -11,8 +12,15 @@ void HistoryCommand::execute(Inventory &, CustomerHashTable &customers) const
     Customer *c = customers.getCustomer(customerID);
     if (!c)
     {
-        std::cerr << "ERROR: Unknown customer ID " << customerID << std::endl;
+        Output::err() << "ERROR: Unknown customer ID " << customerID << std::endl;
         return;
     }
-    c->displayHistory();
-}
\ No newline at end of file
+    c->historySnapshot().display();
+}
+
+CommandRefs HistoryCommand::references() const
+{
+    CommandRefs refs;
+    refs.customerId = customerID;
+    return refs;
+}
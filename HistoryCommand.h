@@ -25,6 +25,9 @@ public:
     // --------------------------------------------------------------------------------------------------------------
     void execute(Inventory &inventory, CustomerHashTable &customers) const override;
 
+    // Post: The customer id (for read-only validation).
+    CommandRefs references() const override;
+
 private:
     int customerID;
 };
@@ -8,16 +8,18 @@
 
 #include "Inventory.h"
 #include "MovieFactory.h"
-#include "comedy.h"
-#include "drama.h"
-#include "classics.h"
+#include "Output.h"
+#include "StringPool.h"
+#include "LineScanner.h"
 
 #include <fstream>    // std::ifstream
-#include <iostream>   // std::cout / std::cerr
-#include <sstream>    // std::istringstream
+#include <iostream>   // std::endl
 #include <algorithm>  // general utilities
 #include <cctype>     // character checks
 #include <stdexcept>  // exceptions
+#include <sstream>    // buffered reload errors
+#include <atomic>     // process-wide reload lag
+#include <chrono>     // staged-reload readiness poll
 
 // ---------------------------------------------------- helpers -------------------------------------------------------
 static inline std::string trim(const std::string &s)
@@ -47,10 +49,15 @@ static inline bool to_int(const std::string &s, int &out)
 // ---------------------------------------------------- ~Inventory ----------------------------------------------------
 Inventory::~Inventory()
 {
+    for (auto &pending : pendingReloads)
+    {
+        for (const StagedTitle &t : pending.delta.get().titles) delete t.movie;
+    }
     for (auto &byCat : inventoryMap)
     {
         for (auto &kv : byCat.second)
         {
+            MemoryAccounting::sub(MemCategory::KEYS, kv.first.size());
             delete kv.second;
         }
     }
@@ -58,61 +65,376 @@ Inventory::~Inventory()
 
 // ---------------------------------------------------- addMovie ------------------------------------------------------
 void Inventory::addMovie(Movie* movie)
+{
+    StringPool::Use use(pool);   // key and Classics actor text
+    if (insertMovie(movie)) classicsIndex.add(movie);
+}
+
+// ---------------------------------------------------- addMovies -----------------------------------------------------
+void Inventory::addMovies(const std::vector<Movie*> &movies)
+{
+    std::vector<const Movie*> added;
+    for (Movie *m : movies)
+    {
+        if (insertMovie(m)) added.push_back(m);
+    }
+    classicsIndex.merge(ClassicsIndex::prepare(added));   // one sort + merge for the whole batch
+}
+
+// --------------------------------------------------- insertMovie ----------------------------------------------------
+bool Inventory::insertMovie(Movie* movie)
 {
     char cat = movie->getCategory();
-    std::string key = movie->buildKey();
+    std::string_view key = pool.add(movie->buildKey());
     auto &m = inventoryMap[cat];
     auto it = m.find(key);
 
     if (it == m.end())
     {
-        m[key] = movie;
+        m.emplace_hint(it, key, movie);
+        registerTitle(movie, key, BloomFilter::hash(key), TrigramIndex::trigramsOf(movie),
+                      PrefixIndex::termsOf(movie));
+        return true;
+    }
+
+    // Merge the duplicate's copies in one step
+    if (it->second->adjustStock(movie->getStock()))
+    {
+        shelfCopies += movie->getStock();
+        totalCopies += movie->getStock();
+        publishStock(it->second);
     }
     else
     {
-        // Merge by increasing stock
-        for (int i = 0; i < movie->getStock(); ++i)
+        Output::err() << "ERROR: stock overflow merging " << cat << " '" << key << "'" << std::endl;
+    }
+    delete movie;
+    return false;
+}
+
+// -------------------------------------------------- registerTitle ---------------------------------------------------
+void Inventory::registerTitle(Movie* movie, std::string_view key, uint64_t h, const std::vector<uint32_t> &grams,
+                              const std::vector<std::string> &terms)
+{
+    const char cat = movie->getCategory();
+    MemoryAccounting::add(MemCategory::KEYS, key.size());
+    titleCache.evict(cat, key, h);   // nothing may keep resolving this key to another Movie
+
+    BloomFilter &filter = keyFilters[GENRE_INDEX[static_cast<unsigned char>(cat)]];
+    filter.add(h);
+    if (filter.needsGrowth())
+    {
+        const TitleMap &m = inventoryMap[cat];
+        filter.reset(m.size() * 2);
+        for (const auto &kv : m) filter.add(BloomFilter::hash(kv.first));
+    }
+    movie->setSlot(slotCount++);
+    moviesBySlot.push_back(movie);
+    keysBySlot.push_back(key);
+    loans.emplace_back();
+    shelfCopies += movie->getStock();
+    totalCopies += movie->getStock();
+    publishStock(movie);
+    textIndex.add(movie, grams);
+    prefixIndex.add(movie, terms);
+    catalog.reset();
+}
+
+// ----------------------------------------------------- lookup -------------------------------------------------------
+Movie* Inventory::lookup(char category, std::string_view key, uint64_t h, std::string_view *storedKey) const
+{
+    const BloomFilter *filter = getKeyFilter(category);
+    if (!filter || !filter->mayContain(h)) return nullptr;
+
+    auto byCat = inventoryMap.find(category);
+    if (byCat != inventoryMap.end())
+    {
+        auto it = byCat->second.find(key);
+        if (it != byCat->second.end())
         {
-            it->second->increaseStock();
+            if (storedKey) *storedKey = it->first;
+            return it->second;
         }
-        delete movie;
     }
+    filter->noteFalsePositive();
+    return nullptr;
 }
 
-// -------------------------------------------------- borrowMovie -----------------------------------------------------
-bool Inventory::borrowMovie(char category, const std::string &key, int /*year*/)
+// ---------------------------------------------------- lookupHot -----------------------------------------------------
+Movie* Inventory::lookupHot(char category, std::string_view key)
+{
+    const uint64_t h = BloomFilter::hash(key);
+    if (Movie *movie = titleCache.find(category, key, h)) return movie;
+
+    std::string_view stored;
+    Movie *movie = lookup(category, key, h, &stored);
+    if (movie) titleCache.insert(category, stored, h, movie);
+    return movie;
+}
+
+// --------------------------------------------------- findMovie ------------------------------------------------------
+Movie* Inventory::findMovie(char category, const std::string &key) const
 {
+    return lookup(category, key, BloomFilter::hash(key));
+}
+
+// -------------------------------------------------- getStringPool ---------------------------------------------------
+StringPool& Inventory::getStringPool()
+{
+    return pool;
+}
+
+// ------------------------------------------------------ getKey ------------------------------------------------------
+std::string_view Inventory::getKey(const Movie *movie) const
+{
+    return keysBySlot[static_cast<size_t>(movie->getSlot())];
+}
+
+// -------------------------------------------------- getTitleCache ---------------------------------------------------
+const TitleCache& Inventory::getTitleCache() const
+{
+    return titleCache;
+}
+
+// -------------------------------------------------- getKeyFilter ----------------------------------------------------
+const BloomFilter* Inventory::getKeyFilter(char category) const
+{
+    static_assert(GENRE_COUNT <= GENRE_SLOTS, "keyFilters must cover every GENRE_TABLE row");
+    const unsigned char c = static_cast<unsigned char>(category);
+    if (c >= GENRE_INDEX.size() || GENRE_INDEX[c] < 0) return nullptr;
+    return &keyFilters[GENRE_INDEX[c]];
+}
+
+// -------------------------------------------------- getTextIndex ----------------------------------------------------
+const TrigramIndex& Inventory::getTextIndex() const
+{
+    return textIndex;
+}
+
+// ------------------------------------------------------- page -------------------------------------------------------
+std::vector<const Movie*> Inventory::page(char category, const std::string &afterKey, size_t limit) const
+{
+    std::vector<const Movie*> out;
     auto byCat = inventoryMap.find(category);
-    if (byCat == inventoryMap.end()) return false;
+    if (byCat == inventoryMap.end() || limit == 0) return out;
+
+    const GenreInfo *genre = MovieFactory::findGenre(category);
+    if (genre && genre->shape == KeyShape::DATE_ACTOR)
+    {
+        // Classics display order comes from the packed-date index; the key is "YYYY-MM|First Last".
+        if (afterKey.empty()) return classicsIndex.after(0, 0, "", limit);
+
+        int year = 0, month = 0;
+        const size_t dash = afterKey.find('-');
+        const size_t bar  = afterKey.find('|');
+        if (dash == std::string::npos || bar == std::string::npos || bar < dash
+            || !to_int(afterKey.substr(0, dash), year) || !to_int(afterKey.substr(dash + 1, bar - dash - 1), month))
+        {
+            return out;
+        }
+        return classicsIndex.after(year, month, std::string_view(afterKey).substr(bar + 1), limit);
+    }
 
-    auto it = byCat->second.find(key);
-    if (it == byCat->second.end()) return false;
+    const auto &byKey = byCat->second;
+    for (auto it = afterKey.empty() ? byKey.begin() : byKey.upper_bound(afterKey);
+         it != byKey.end() && out.size() < limit; ++it)
+    {
+        out.push_back(it->second);
+    }
+    return out;
+}
+
+// ------------------------------------------------ getClassicsIndex --------------------------------------------------
+const ClassicsIndex& Inventory::getClassicsIndex() const
+{
+    return classicsIndex;
+}
 
-    return it->second->decreaseStock();
+// ------------------------------------------------- getPrefixIndex ---------------------------------------------------
+const PrefixIndex& Inventory::getPrefixIndex() const
+{
+    return prefixIndex;
+}
+
+// -------------------------------------------------- borrowMovie -----------------------------------------------------
+Movie* Inventory::borrowMovie(char category, const std::string &key, int customerId)
+{
+    Movie *movie = lookupHot(category, key);
+    if (!movie || !movie->decreaseStock()) return nullptr;
+    publishStock(movie);
+
+    const int slot = movie->getSlot();
+    LoanState &loan = loans[slot];
+    ++loan.checkedOut;
+    ++loan.holders[customerId];
+    ++loansByCustomer[customerId][slot];
+    outstandingSlots.insert(slot);
+    --shelfCopies;
+    ++checkedOutCopies;
+    return movie;
 }
 
 // -------------------------------------------------- returnMovie -----------------------------------------------------
-bool Inventory::returnMovie(char category, const std::string &key, int /*year*/)
+Movie* Inventory::returnMovie(char category, const std::string &key, int customerId)
 {
-    auto byCat = inventoryMap.find(category);
-    if (byCat == inventoryMap.end()) return false;
+    Movie *movie = lookupHot(category, key);
+    if (!movie) return nullptr;
 
-    auto it = byCat->second.find(key);
-    if (it == byCat->second.end()) return false;
+    const int slot = movie->getSlot();
+    LoanState &loan = loans[slot];
+    auto holder = loan.holders.find(customerId);
+    if (holder == loan.holders.end()) return nullptr;   // copy was not checked out to this customer
 
-    it->second->increaseStock();
-    return true;
+    movie->increaseStock();
+    publishStock(movie);
+
+    if (--holder->second == 0) loan.holders.erase(holder);
+    if (--loan.checkedOut == 0) outstandingSlots.erase(slot);
+    auto byCust = loansByCustomer.find(customerId);
+    auto held = byCust->second.find(slot);
+    if (--held->second == 0) byCust->second.erase(held);
+    if (byCust->second.empty()) loansByCustomer.erase(byCust);
+    ++shelfCopies;
+    --checkedOutCopies;
+    return movie;
+}
+
+// -------------------------------------------------- adjustStock -----------------------------------------------------
+Movie* Inventory::adjustStock(char category, const std::string &key, int delta)
+{
+    Movie *movie = lookupHot(category, key);
+    if (!movie || !movie->adjustStock(delta)) return nullptr;
+    publishStock(movie);
+
+    shelfCopies += delta;
+    totalCopies += delta;
+    return movie;
+}
+
+// -------------------------------------------------- loan queries ----------------------------------------------------
+int Inventory::getCheckedOut(const Movie *movie) const
+{
+    return loans[movie->getSlot()].checkedOut;
+}
+
+const std::unordered_map<int, int>& Inventory::getHolders(const Movie *movie) const
+{
+    return loans[movie->getSlot()].holders;
+}
+
+// Display order shared by the loan reports: genre table order, then canonical key.
+static bool displayBefore(const Movie *a, const Movie *b)
+{
+    if (a->getCategory() != b->getCategory())
+    {
+        return GENRE_INDEX[static_cast<unsigned char>(a->getCategory())]
+             < GENRE_INDEX[static_cast<unsigned char>(b->getCategory())];
+    }
+    return a->buildKey() < b->buildKey();
+}
+
+std::vector<const Movie*> Inventory::getOutstandingTitles() const
+{
+    std::vector<const Movie*> out;
+    out.reserve(outstandingSlots.size());
+    for (int slot : outstandingSlots)
+    {
+        out.push_back(moviesBySlot[slot]);
+    }
+    std::sort(out.begin(), out.end(), displayBefore);
+    return out;
+}
+
+std::vector<std::pair<const Movie*, int>> Inventory::getCustomerLoans(int customerId) const
+{
+    std::vector<std::pair<const Movie*, int>> out;
+    auto byCust = loansByCustomer.find(customerId);
+    if (byCust == loansByCustomer.end()) return out;
+
+    for (const auto &kv : byCust->second)
+    {
+        out.emplace_back(moviesBySlot[kv.first], kv.second);
+    }
+    std::sort(out.begin(), out.end(), [](const std::pair<const Movie*, int> &a, const std::pair<const Movie*, int> &b)
+    {
+        return displayBefore(a.first, b.first);
+    });
+    return out;
+}
+
+// ------------------------------------------------- checkInvariant ---------------------------------------------------
+bool Inventory::checkInvariant() const
+{
+    return shelfCopies + checkedOutCopies == totalCopies;
+}
+
+long long Inventory::getShelfCopies() const
+{
+    return shelfCopies;
+}
+
+long long Inventory::getCheckedOutCopies() const
+{
+    return checkedOutCopies;
+}
+
+long long Inventory::getTotalCopies() const
+{
+    return totalCopies;
+}
+
+int Inventory::getTitleCount() const
+{
+    return slotCount;
+}
+
+const Movie* Inventory::getMovieAtSlot(int slot) const
+{
+    return moviesBySlot[slot];
+}
+
+// -------------------------------------------------- getPopularity ---------------------------------------------------
+PopularityTracker& Inventory::getPopularity()
+{
+    return popularity;
+}
+
+// -------------------------------------------------- getCoBorrows ----------------------------------------------------
+CoBorrowTracker& Inventory::getCoBorrows()
+{
+    return coBorrows;
+}
+
+// ------------------------------------------------ command sequence --------------------------------------------------
+uint64_t Inventory::advanceCommandSeq()
+{
+    return ++commandSeq;
+}
+
+uint64_t Inventory::getCommandSeq() const
+{
+    return commandSeq;
+}
+
+void Inventory::setCommandSeq(uint64_t seq)
+{
+    commandSeq = seq;
 }
 
 // ------------------------------------------------ displayInventory --------------------------------------------------
 void Inventory::displayInventory() const
 {
-    auto printCat = [&](char cat, const std::string &label)
+    auto printCat = [&](const GenreInfo &genre)
     {
-        auto it = inventoryMap.find(cat);
+        auto it = inventoryMap.find(genre.code);
         if (it == inventoryMap.end()) return;
 
-        std::cout << "=== " << label << " ===" << std::endl;
+        Output::out() << "=== " << genre.label << " ===" << std::endl;
+        if (genre.shape == KeyShape::DATE_ACTOR)
+        {
+            for (const Movie *m : classicsIndex.ordered()) m->display();
+            return;
+        }
         for (const auto &kv : it->second)
         {
             if (kv.second)
@@ -122,123 +444,333 @@ void Inventory::displayInventory() const
         }
     };
 
-    printCat('F', "Comedy");
-    printCat('D', "Drama");
-    printCat('C', "Classics");
+    for (const GenreInfo &genre : GENRE_TABLE)
+    {
+        printCat(genre);
+    }
 }
 
-// --------------------------------------------------- loadMovies -----------------------------------------------------
-void Inventory::loadMovies(const std::string &filename)
+// ---------------------------------------------------- snapshot ------------------------------------------------------
+InventorySnapshot Inventory::snapshot()
 {
-    std::ifstream fin(filename);
-    if (!fin)
+    if (!catalog)
+    {
+        auto built = std::make_shared<InventorySnapshot::Catalog>();
+        auto addSection = [&](const GenreInfo &genre)
+        {
+            auto it = inventoryMap.find(genre.code);
+            if (it == inventoryMap.end()) return;
+
+            InventorySnapshot::Section section{genre.code, genre.label, {}};
+            if (genre.shape == KeyShape::DATE_ACTOR)
+            {
+                section.movies = classicsIndex.ordered();   // packed (date, actor rank) order
+            }
+            else
+            {
+                section.movies.reserve(it->second.size());
+                for (const auto &kv : it->second)
+                {
+                    if (kv.second) section.movies.push_back(kv.second);
+                }
+            }
+            built->push_back(std::move(section));
+        };
+
+        for (const GenreInfo &genre : GENRE_TABLE)
+        {
+            addSection(genre);
+        }
+        catalog = built;
+    }
+    return InventorySnapshot(catalog, stockTable);
+}
+
+// -------------------------------------------------- publishStock ----------------------------------------------------
+void Inventory::publishStock(const Movie *movie)
+{
+    const size_t slot  = static_cast<size_t>(movie->getSlot());
+    const size_t chunk = slot / InventorySnapshot::CHUNK_SIZE;
+
+    // A snapshot still references this version: writers move on to a private copy of the chunk pointers.
+    if (stockTable.use_count() > 1)
+    {
+        stockTable = std::make_shared<InventorySnapshot::StockTable>(*stockTable);
+    }
+    if (chunk >= stockTable->size())
     {
-        std::cerr << "ERROR: cannot open movies file: " << filename << std::endl;
-        return;
+        stockTable->resize(chunk + 1);
+        stockTable->back() = std::make_shared<InventorySnapshot::StockChunk>();
     }
 
-    std::string line;
+    auto &c = (*stockTable)[chunk];
+    if (c.use_count() > 1)
+    {
+        c = std::make_shared<InventorySnapshot::StockChunk>(*c);
+    }
+    (*c)[slot % InventorySnapshot::CHUNK_SIZE] = movie->getStock();
+}
+
+// --------------------------------------------------- parseMovies ----------------------------------------------------
+// Parses every line of a movies stream into new Movie objects (appended to parsed, caller owns them). Problems are
+// written to err, one line each, so a background parse can buffer them and report at apply time.
+static void parseMovies(std::istream &fin, std::vector<Movie*> &parsed, std::ostream &err)
+{
+    LineReader reader(',');
+    reader.attach(fin);
+    std::string_view line;
     int lineno = 0;
 
-    while (std::getline(fin, line))
+    while (reader.next(line))
     {
         ++lineno;
-        std::string raw = trim(line);
+        const std::string_view raw = LineScanner::trim(line);
         if (raw.empty()) continue;
 
-        // Extract category code and find first comma
+        // The first four commas delimit code, stock, director, title and the genre-specific tail. The reader
+        // already indexed them relative to the untrimmed line (trimming never drops a comma).
+        const std::vector<uint32_t> &fields = reader.fields();
+        const uint32_t lead  = static_cast<uint32_t>(raw.data() - line.data());
+        const size_t   found = std::min<size_t>(fields.size(), 4);
+        uint32_t commas[4];
+        for (size_t i = 0; i < found; ++i) commas[i] = fields[i] - lead;
         char code = raw[0];
-        size_t firstComma = raw.find(',');
-        if (firstComma == std::string::npos)
+        if (found == 0)
         {
-            std::cerr << "ERROR: [" << lineno << "] missing comma after code -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] missing comma after code -> " << raw << std::endl;
             continue;
         }
-        if (code != 'F' && code != 'D' && code != 'C')
+        const GenreInfo *genre = MovieFactory::findGenre(code);
+        if (!genre)
         {
-            std::cerr << "ERROR: [" << lineno << "] invalid movie code '" << code << "' -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] invalid movie code '" << code << "' -> " << raw << std::endl;
             continue;
         }
 
-        // rest after "code,"
-        std::string rest = trim(raw.substr(firstComma + 1));
-
-        // Split the first three comma-separated tokens: stock, director, title
-        size_t c1 = rest.find(',');
-        size_t c2 = (c1 == std::string::npos) ? std::string::npos : rest.find(',', c1 + 1);
-        if (c1 == std::string::npos || c2 == std::string::npos)
+        if (found < 3)
         {
-            std::cerr << "ERROR: [" << lineno << "] not enough fields -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] not enough fields -> " << raw << std::endl;
             continue;
         }
-        std::string stock_s  = trim(rest.substr(0, c1));
-        std::string director = trim(rest.substr(c1 + 1, c2 - (c1 + 1)));
-        std::string title    = trim(rest.substr(c2 + 1));
-
-        // For classics, 'title' may still contain ", ActorFirst ActorLast month year"
-        size_t c3 = title.find(',');
-        std::string tail;
-        if (c3 != std::string::npos)
+        auto field = [&](size_t from, size_t to)
         {
-            tail  = trim(title.substr(c3 + 1));
-            title = trim(title.substr(0, c3));
-        }
+            return std::string(LineScanner::trim(raw.substr(from, to - from)));
+        };
+        const std::string stock_s  = field(commas[0] + 1, commas[1]);
+        const std::string director = field(commas[1] + 1, commas[2]);
+
+        // The tail is genre specific, e.g. "Year" or "ActorFirst ActorLast month year".
+        const std::string title = field(commas[2] + 1, found > 3 ? commas[3] : raw.size());
+        const std::string tail  = found > 3 ? field(commas[3] + 1, raw.size()) : std::string();
 
         int stock = 0;
         if (!to_int(stock_s, stock) || stock < 0)
         {
-            std::cerr << "ERROR: [" << lineno << "] invalid stock -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] invalid stock -> " << raw << std::endl;
             continue;
         }
 
         try
         {
-            if (code == 'F' || code == 'D')
-            {
-                // tail should be the year for F/D
-                int year = 0;
-                if (!to_int(tail, year))
-                {
-                    std::cerr << "ERROR: [" << lineno << "] invalid year -> " << raw << std::endl;
-                    continue;
-                }
-
-                Movie *m = (code == 'F')
-                    ? static_cast<Movie*>(new Comedy(title, stock, director, year))
-                    : static_cast<Movie*>(new Drama(title, stock, director, year));
-                addMovie(m);
-            }
-            else
+            std::string error;
+            Movie *m = genre->parse(title, stock, director, tail, error);
+            if (!m)
             {
-                // Classics: tail = "ActorFirst ActorLast month year"
-                std::istringstream tss(tail);
-                std::string actorFirst, actorLast;
-                int month = 0, year = 0;
-
-                if (!(tss >> actorFirst >> actorLast >> month >> year))
-                {
-                    std::cerr << "ERROR: [" << lineno << "] invalid classics tail -> " << raw << std::endl;
-                    continue;
-                }
-                if (month < 1 || month > 12)
-                {
-                    std::cerr << "ERROR: [" << lineno << "] invalid month -> " << raw << std::endl;
-                    continue;
-                }
-
-                Movie *m = new Classics(title, stock, director, month, year, actorFirst, actorLast);
-                addMovie(m);
+                err << "ERROR: [" << lineno << "] " << error << " -> " << raw << std::endl;
+                continue;
             }
+            parsed.push_back(m);
         }
         catch (const std::exception &e)
         {
-            std::cerr << "ERROR: [" << lineno << "] exception: " << e.what() << " -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] exception: " << e.what() << " -> " << raw << std::endl;
             continue;
         }
         catch (...)
         {
-            std::cerr << "ERROR: [" << lineno << "] unknown exception -> " << raw << std::endl;
+            err << "ERROR: [" << lineno << "] unknown exception -> " << raw << std::endl;
             continue;
         }
     }
 }
+
+static bool parseMovies(const std::string &filename, std::vector<Movie*> &parsed, std::ostream &err)
+{
+    std::ifstream fin(filename);
+    if (!fin)
+    {
+        err << "ERROR: cannot open movies file: " << filename << std::endl;
+        return false;
+    }
+    parseMovies(fin, parsed, err);
+    return true;
+}
+
+// --------------------------------------------------- loadMovies -----------------------------------------------------
+void Inventory::loadMovies(const std::string &filename)
+{
+    StringPool::Use use(pool);   // movie text, keys and Classics actors
+    std::vector<Movie*> parsed;
+    parseMovies(filename, parsed, Output::err());
+    addMovies(parsed);
+}
+
+void Inventory::loadMovies(std::istream &in)
+{
+    StringPool::Use use(pool);
+    std::vector<Movie*> parsed;
+    parseMovies(in, parsed, Output::err());
+    addMovies(parsed);
+}
+
+// --------------------------------------------------- startReload ----------------------------------------------------
+static std::atomic<uint64_t> RELOAD_LAG{Inventory::DEFAULT_RELOAD_LAG};
+
+void Inventory::startReload(const std::string &filename)
+{
+    const uint64_t lag = RELOAD_LAG.load(std::memory_order_relaxed);
+    startReload(filename, lag == 0 ? 0 : commandSeq + lag);
+}
+
+void Inventory::startReload(const std::string &filename, uint64_t dueSeq)
+{
+    const std::launch policy = foregroundReloads ? std::launch::deferred : std::launch::async;
+    pendingReloads.push_back(PendingReload{filename, dueSeq, std::async(policy, stageReload, filename, &pool)});
+}
+
+void Inventory::setForegroundReloads(bool on)
+{
+    foregroundReloads = on;
+}
+
+void Inventory::setReloadLag(uint64_t lag)
+{
+    RELOAD_LAG.store(lag, std::memory_order_relaxed);
+}
+
+uint64_t Inventory::getReloadLag()
+{
+    return RELOAD_LAG.load(std::memory_order_relaxed);
+}
+
+std::vector<std::pair<uint64_t, std::string>> Inventory::getPendingReloads() const
+{
+    std::vector<std::pair<uint64_t, std::string>> out;
+    for (const PendingReload &pending : pendingReloads) out.emplace_back(pending.dueSeq, pending.filename);
+    return out;
+}
+
+// --------------------------------------------------- stageReload ----------------------------------------------------
+// Runs on the reload's own thread (or deferred, see setForegroundReloads) and reads nothing of the live inventory but its (locked) pool: parse, collapse
+// repeated keys, intern keys, and build the map nodes, key hashes, trigrams, prefix terms and Classics run that the
+// merge splices in.
+Inventory::ReloadDelta Inventory::stageReload(const std::string &filename, StringPool *pool)
+{
+    StringPool::Use use(*pool);
+    ReloadDelta delta;
+    delta.filename = filename;
+    std::ostringstream err;
+    std::vector<Movie*> parsed;
+    parseMovies(filename, parsed, err);
+    delta.rows = parsed.size();
+
+    std::vector<const Movie*> movies;
+    for (Movie *m : parsed)
+    {
+        const char cat = m->getCategory();
+        const std::string_view key = pool->add(m->buildKey());
+        auto placed = delta.staged[cat].emplace(key, m);
+        if (!placed.second)
+        {
+            // Repeated key within the delta: fold its copies into the first row, as addMovie would.
+            if (!placed.first->second->adjustStock(m->getStock()))
+            {
+                err << "ERROR: stock overflow merging " << cat << " '" << key << "'" << std::endl;
+            }
+            delete m;
+            continue;
+        }
+        delta.titles.push_back(StagedTitle{m, key, BloomFilter::hash(key), TrigramIndex::trigramsOf(m),
+                                           PrefixIndex::termsOf(m)});
+        movies.push_back(m);
+    }
+    delta.classics = ClassicsIndex::prepare(movies);
+    delta.errors   = err.str();
+    return delta;
+}
+
+// --------------------------------------------------- mergeReload ----------------------------------------------------
+int Inventory::mergeReload(ReloadDelta &delta)
+{
+    // Splice the prebuilt nodes: keys new to the catalog move into the live maps without allocating; keys already
+    // stocked stay behind in the staged map and become restocks of the live title.
+    std::unordered_set<const Movie*> restocked;
+    for (auto &byCat : delta.staged)
+    {
+        TitleMap &live = inventoryMap[byCat.first];
+        live.merge(byCat.second);
+        for (const auto &kv : byCat.second)
+        {
+            Movie *movie = live.find(kv.first)->second;
+            if (movie->adjustStock(kv.second->getStock()))
+            {
+                shelfCopies += kv.second->getStock();
+                totalCopies += kv.second->getStock();
+                publishStock(movie);
+            }
+            else
+            {
+                Output::err() << "ERROR: stock overflow merging " << byCat.first << " '" << kv.first << "'"
+                              << std::endl;
+            }
+            restocked.insert(kv.second);
+        }
+    }
+
+    // New titles take slots in file order, exactly as one addMovie per row would have assigned them.
+    int added = 0;
+    for (const StagedTitle &t : delta.titles)
+    {
+        if (restocked.count(t.movie)) continue;
+        registerTitle(t.movie, t.key, t.hash, t.grams, t.terms);
+        ++added;
+    }
+    if (!restocked.empty())
+    {
+        delta.classics.erase(std::remove_if(delta.classics.begin(), delta.classics.end(),
+                                            [&](const ClassicsIndex::Entry &e) { return restocked.count(e.movie); }),
+                             delta.classics.end());
+    }
+    classicsIndex.merge(delta.classics);
+
+    for (const StagedTitle &t : delta.titles)
+    {
+        if (restocked.count(t.movie)) delete t.movie;
+    }
+    return added;
+}
+
+// --------------------------------------------------- applyReload ----------------------------------------------------
+bool Inventory::applyReload(bool all)
+{
+    bool applied = false;
+    while (!pendingReloads.empty())
+    {
+        PendingReload &front = pendingReloads.front();
+        // A deferred (foreground) staging counts as finished: get() runs it right here.
+        const bool due = front.dueSeq == 0
+                       ? front.delta.wait_for(std::chrono::seconds(0)) != std::future_status::timeout
+                       : front.dueSeq <= commandSeq + 1;
+        if (!all && !due) break;
+
+        ReloadDelta delta = front.delta.get();   // blocks only if staging is still running
+        pendingReloads.pop_front();
+        Output::err() << delta.errors;
+
+        const int added = mergeReload(delta);
+        Output::err() << "[info] Reloaded " << delta.filename << " before command " << commandSeq + 1 << ": "
+                      << added << " added, " << (static_cast<int>(delta.rows) - added) << " restocked" << std::endl;
+        applied = true;
+    }
+    return applied;
+}
@@ -5,14 +5,37 @@
 // --------------------------------------------------------------------------------------------------------------------
 // Purpose : Holds all movies, keyed by category and canonical key (see Movie::buildKey()).
 //           Supports add/borrow/return and printing by required category order.
+//           Every stock change is also published to a copy-on-write stock table so read-only commands can take an
+//           O(1) InventorySnapshot and render from it while borrows/returns keep committing.
+//           Catalog deltas are staged in the background and merged at a fixed later command (startReload/applyReload).
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef INVENTORY_H
 #define INVENTORY_H
 
-#include "movie.h"   // base class interface for Movie hierarchy
-#include <map>       // ordered category/key traversal
-#include <string>    // std::string keys
+#include "movie.h"              // base class interface for Movie hierarchy
+#include "InventorySnapshot.h"  // versioned stock table + read views
+#include "TrigramIndex.h"       // fuzzy title/director/actor lookup
+#include "PrefixIndex.h"        // type-ahead over titles/directors
+#include "PopularityTracker.h"  // streaming borrow popularity
+#include "CoBorrowTracker.h"    // "also borrowed" neighbors
+#include "ClassicsIndex.h"      // packed-date Classics order
+#include "MemoryAccounting.h"   // map node accounting
+#include "BloomFilter.h"        // unknown-key rejection
+#include "TitleCache.h"         // hot-title lookups
+#include "StringPool.h"         // per-inventory catalog text
+#include <cstdint>              // command sequence numbers
+#include <deque>                // reloads in flight
+#include <future>               // background delta parse
+#include <istream>              // loadMovies from a stream
+#include <unordered_map>        // loan reverse indexes
+#include <unordered_set>        // titles with outstanding loans
+#include <utility>              // std::pair
+#include <vector>               // per-slot loan state
+#include <map>                  // ordered category/key traversal
+#include <memory>               // std::shared_ptr versions
+#include <string>               // std::string keys
+#include <string_view>          // interned map keys
 
 class Inventory
 {
@@ -25,26 +48,249 @@ public:
     void addMovie(Movie* movie);
 
     // ------------------------------------------------ borrowMovie ---------------------------------------------------
-    // Description: Decrement stock for a movie if available.
-    // Returns    : true on success; false if not found or out of stock.
-    bool borrowMovie(char category, const std::string &key, int year);
+    // Description: Decrement stock for a movie if available and record the copy as checked out to customerId.
+    // Returns    : The borrowed Movie on success; nullptr if not found or out of stock.
+    Movie* borrowMovie(char category, const std::string &key, int customerId);
 
     // ------------------------------------------------ returnMovie ---------------------------------------------------
-    // Description: Increment stock for a movie if it exists.
-    // Returns    : true on success; false if the movie/key is unknown.
-    bool returnMovie(char category, const std::string &key, int year);
+    // Description: Increment stock for a movie checked out to customerId and release that loan.
+    // Returns    : The returned Movie on success; nullptr if the movie/key is unknown or the customer holds no copy.
+    Movie* returnMovie(char category, const std::string &key, int customerId);
+
+    // ------------------------------------------------ adjustStock ---------------------------------------------------
+    // Description: Add 'delta' shelf copies to a title in one O(1) step (negative removes); checked-out copies are
+    //              untouched, so the invariant holds.
+    // Returns    : The adjusted Movie; nullptr if the key is unknown or the shelf stock would drop below zero (or
+    //              overflow), in which case nothing changed.
+    Movie* adjustStock(char category, const std::string &key, int delta);
+
+    // ------------------------------------------------ loan queries --------------------------------------------------
+    // Description: O(1) checked-out count for a title, and its holders (customer id -> copies held).
+    int                                 getCheckedOut(const Movie *movie) const;
+    const std::unordered_map<int, int>& getHolders(const Movie *movie) const;
+
+    // Description: Titles with at least one copy out, in display order (genre table order, then key).
+    std::vector<const Movie*> getOutstandingTitles() const;
+
+    // Description: Titles held by one customer (movie -> copies), in display order; empty if none.
+    std::vector<std::pair<const Movie*, int>> getCustomerLoans(int customerId) const;
+
+    // ---------------------------------------------- checkInvariant --------------------------------------------------
+    // Description: O(1) check that, summed over all titles, copies on shelf + copies checked out == copies stocked.
+    bool      checkInvariant() const;
+    long long getShelfCopies() const;
+    long long getCheckedOutCopies() const;
+    long long getTotalCopies() const;
+    int       getTitleCount() const;   // distinct titles stocked
+
+    // Description: Title whose Movie::getSlot() is slot (0 <= slot < getTitleCount()); slots follow insertion order.
+    const Movie* getMovieAtSlot(int slot) const;
+
+    // ------------------------------------------------- findMovie ----------------------------------------------------
+    // Description: Exact lookup by category + canonical key.
+    // Returns    : The stocked Movie (no ownership transfer), or nullptr if unknown.
+    Movie* findMovie(char category, const std::string &key) const;
+
+    // ---------------------------------------------- getStringPool ---------------------------------------------------
+    // Description: Pool holding this inventory's catalog text; bind it (StringPool::Use) on a thread that works
+    //              only on this inventory.
+    StringPool& getStringPool();
+
+    // -------------------------------------------------- getKey ------------------------------------------------------
+    // Description: O(1) stored (interned) key of a stocked movie; the view lives as long as this inventory.
+    std::string_view getKey(const Movie *movie) const;
+
+    // ----------------------------------------------- getKeyFilter ---------------------------------------------------
+    // Description: Bloom filter over one genre's keys (nullptr for unknown codes); findMovie, borrowMovie and
+    //              returnMovie consult it before descending the map.
+    const BloomFilter* getKeyFilter(char category) const;
+
+    // ----------------------------------------------- getTitleCache --------------------------------------------------
+    // Description: Hot-title cache that borrowMovie, returnMovie and adjustStock consult before the filter and maps.
+    const TitleCache& getTitleCache() const;
+
+    // ----------------------------------------------- getTextIndex ---------------------------------------------------
+    // Description: Trigram index over every stocked movie; used for "did you mean" suggestions and search.
+    const TrigramIndex& getTextIndex() const;
+
+    // ---------------------------------------------- getPrefixIndex --------------------------------------------------
+    // Description: Radix trie over normalized titles and directors of every stocked movie.
+    const PrefixIndex& getPrefixIndex() const;
+
+    // --------------------------------------------- getClassicsIndex -------------------------------------------------
+    // Description: Classics sorted by packed release date + actor; serves date-range queries and Classics order.
+    const ClassicsIndex& getClassicsIndex() const;
+
+    // ---------------------------------------------- getPopularity ---------------------------------------------------
+    // Description: Borrow-popularity engine; BorrowCommand records into it, the T command reads from it.
+    PopularityTracker& getPopularity();
+
+    // ----------------------------------------------- getCoBorrows ---------------------------------------------------
+    // Description: Co-borrow neighbor lists; BorrowCommand records into it, the A command reads from it.
+    CoBorrowTracker& getCoBorrows();
+
+    // ------------------------------------------- command sequence ---------------------------------------------------
+    // Description: Number of commands dispatched against this inventory so far; the command processor advances it
+    //              once per parsed command, and time-windowed statistics are measured in it.
+    uint64_t advanceCommandSeq();
+    uint64_t getCommandSeq() const;
+    void     setCommandSeq(uint64_t seq);   // checkpoint resume
+
+    // --------------------------------------------------- page -------------------------------------------------------
+    // Description: Up to 'limit' movies of one category that follow canonical key 'afterKey' (empty = from the
+    //              start) in display order. O(log n + limit) at any depth.
+    std::vector<const Movie*> page(char category, const std::string &afterKey, size_t limit) const;
 
     // ---------------------------------------------- displayInventory ------------------------------------------------
     // Description: Print inventory by category in assignment-specified format and order.
     void displayInventory() const;
 
+    // ------------------------------------------------- snapshot -----------------------------------------------------
+    // Description: O(1) consistent view of catalog order and stock. The catalog order is rebuilt lazily (once)
+    //              after movies were added; stock versions are shared until the next write.
+    InventorySnapshot snapshot();
+
     // ------------------------------------------------ loadMovies ----------------------------------------------------
     // Description: Load movies file; validates fields and merges duplicates by key.
     void loadMovies(const std::string &filename);
+    void loadMovies(std::istream &in);
+
+    // ------------------------------------------------ startReload ---------------------------------------------------
+    // Description: Begin parsing a delta file (same format as the movies file) on a background thread while
+    //              commands keep running. With a reload lag of n > 0 the delta takes effect just before command
+    //              number getCommandSeq() + n, whatever the parse's timing, so a replay always merges it at the same
+    //              point. With lag 0 it takes effect at the first command after staging finishes (due command 0);
+    //              that point depends on timing and is reported with the merge. The second form resumes a reload
+    //              saved by a checkpoint with its original due command number. Several reloads may be in flight;
+    //              they are applied in the order started.
+    static constexpr uint64_t DEFAULT_RELOAD_LAG = 16;
+    void startReload(const std::string &filename);
+    void startReload(const std::string &filename, uint64_t dueSeq);
+
+    // Description: Process-wide reload lag in commands for reloads started after the call (0 = when staged).
+    static void     setReloadLag(uint64_t lag);
+    static uint64_t getReloadLag();
+
+    // Description: Reloads started but not merged yet, as (due command number, file), oldest first.
+    std::vector<std::pair<uint64_t, std::string>> getPendingReloads() const;
+
+    // Description: With on, reloads started afterwards start no thread: the delta is parsed by the applyReload call
+    //              that merges it, at the same command as in the background case (a due-0 reload merges before the
+    //              next command). Used by as-of replays (see TimeTravel.h).
+    void setForegroundReloads(bool on);
+
+    // ------------------------------------------------ applyReload ---------------------------------------------------
+    // Description: Merge, oldest first, every pending reload that is due before the next command (with all, every
+    //              pending reload, e.g. at end of input), waiting for its background work if it is still running;
+    //              a reload due "when staged" is merged only once its staging has finished.
+    //              New keys are inserted, existing keys gain stock, and loans are untouched. The background thread
+    //              has already parsed the delta, built its map nodes, keys and index entries, so the merge itself
+    //              only splices them in. Parse errors are reported here.
+    // Returns    : true if at least one delta was applied.
+    bool applyReload(bool all);
 
 private:
-    // category -> (key -> Movie*)
-    std::map<char, std::map<std::string, Movie*>> inventoryMap;
+    // ------------------------------------------------ insertMovie ---------------------------------------------------
+    // Description: addMovie() minus the Classics index, so batches can index their new Classics in one merge.
+    // Returns    : true if movie became a new title (kept); false if it was merged into an existing one (deleted).
+    bool insertMovie(Movie* movie);
+
+    // Description: Bookkeeping for a title just placed in the map under 'key': slot, loans, stock, key filter and
+    //              the text indexes (Classics excepted), from precomputed hash, trigrams and prefix terms.
+    void registerTitle(Movie* movie, std::string_view key, uint64_t h, const std::vector<uint32_t> &grams,
+                       const std::vector<std::string> &terms);
+
+    // Description: addMovie() for every movie, with the Classics index updated once for the batch.
+    void addMovies(const std::vector<Movie*> &movies);
+
+    // -------------------------------------------------- lookup ------------------------------------------------------
+    // Description: Stocked movie for category + key (h = BloomFilter::hash(key)), or nullptr; keys the genre's
+    //              filter has never seen are rejected without a map descent. storedKey (optional) receives the
+    //              interned map key on success.
+    Movie* lookup(char category, std::string_view key, uint64_t h, std::string_view *storedKey = nullptr) const;
+
+    // Description: lookup() behind the hot-title cache; fills the cache on a map hit. Mutating paths only.
+    Movie* lookupHot(char category, std::string_view key);
+
+    // ----------------------------------------------- publishStock ---------------------------------------------------
+    // Description: Copy movie's live stock into the current stock version, cloning shared parts first.
+    void publishStock(const Movie *movie);
+
+    // catalog text (titles, names, keys) of this inventory only; the first member, so it is released last
+    StringPool pool;
+
+    // category -> (key -> Movie*); keys are interned in pool and shared with customer loan sets
+    using TitleMap = std::map<std::string_view, Movie*, std::less<std::string_view>,
+                              CountingAllocator<std::pair<const std::string_view, Movie*>, MemCategory::INVENTORY_MAP>>;
+    std::map<char, TitleMap, std::less<char>,
+             CountingAllocator<std::pair<const char, TitleMap>, MemCategory::INVENTORY_MAP>> inventoryMap;
+
+    // per-genre key filters, indexed like GENRE_TABLE and maintained by addMovie
+    static constexpr size_t GENRE_SLOTS = 8;
+    BloomFilter             keyFilters[GENRE_SLOTS];
+
+    // borrow/return/restock lookups of the hottest titles
+    TitleCache              titleCache;
+
+    // search indexes, maintained by addMovie
+    TrigramIndex  textIndex;
+    PrefixIndex   prefixIndex;
+    ClassicsIndex classicsIndex;
+
+    // loan bookkeeping, indexed by Movie::getSlot(); all updates are O(1) from borrow/return
+    struct LoanState
+    {
+        int                          checkedOut = 0;
+        std::unordered_map<int, int> holders;        // customer id -> copies held
+    };
+    std::vector<LoanState>                                loans;
+    std::unordered_set<int>                               outstandingSlots;
+    std::unordered_map<int, std::unordered_map<int, int>> loansByCustomer;   // customer -> (slot -> copies)
+    std::vector<Movie*>                                   moviesBySlot;
+    std::vector<std::string_view>                         keysBySlot;
+    long long                                             shelfCopies      = 0;
+    long long                                             checkedOutCopies = 0;
+    long long                                             totalCopies      = 0;
+
+    // borrow statistics
+    PopularityTracker popularity;
+    CoBorrowTracker   coBorrows;
+    uint64_t          commandSeq = 0;
+
+    // versioned read-side state (see InventorySnapshot.h)
+    std::shared_ptr<InventorySnapshot::StockTable>    stockTable = std::make_shared<InventorySnapshot::StockTable>();
+    std::shared_ptr<const InventorySnapshot::Catalog> catalog;   // nullptr = rebuild on next snapshot()
+    int                                               slotCount  = 0;
+
+    // catalog delta staged off-thread by startReload, merged by applyReload
+    struct StagedTitle
+    {
+        Movie                   *movie;   // owned until merged
+        std::string_view         key;     // interned
+        uint64_t                 hash;    // BloomFilter::hash(key)
+        std::vector<uint32_t>    grams;   // TrigramIndex::trigramsOf(movie)
+        std::vector<std::string> terms;   // PrefixIndex::termsOf(movie)
+    };
+    struct ReloadDelta
+    {
+        std::string                       filename;
+        std::string                       errors;     // buffered parse diagnostics
+        size_t                            rows = 0;   // parsed lines, duplicates included
+        std::map<char, TitleMap>          staged;     // map nodes of the delta's distinct keys, ready to splice
+        std::vector<StagedTitle>          titles;     // the same titles, in file order
+        std::vector<ClassicsIndex::Entry> classics;   // sorted run of the delta's Classics
+    };
+    struct PendingReload
+    {
+        std::string              filename;
+        uint64_t                 dueSeq;
+        std::future<ReloadDelta> delta;
+    };
+    std::deque<PendingReload> pendingReloads;
+    bool                      foregroundReloads = false;
+
+    static ReloadDelta stageReload(const std::string &filename, StringPool *pool);   // background thread
+    int                mergeReload(ReloadDelta &delta);             // returns titles added
 };
 
 #endif // INVENTORY_H
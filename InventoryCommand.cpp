@@ -1,10 +1,10 @@
 // --------------------------------------------- InventoryCommand.cpp -------------------------------------------------
-// Prints the store’s current inventory.
+// Prints the store’s current inventory from an O(1) snapshot, so rendering never holds up borrows/returns.
 
 #include "InventoryCommand.h"
 #include "Inventory.h"
 
 void InventoryCommand::execute(Inventory &inventory, CustomerHashTable &) const
 {
-    inventory.displayInventory();
+    inventory.snapshot().display();
 }
\ No newline at end of file
@@ -21,7 +21,7 @@ public:
 
     // --------------------------------------------------------------------------------------------------------------
     // execute
-    // Post: Calls Inventory::displayInventory() to print all movies in required order/format.
+    // Post: Takes Inventory::snapshot() and prints all movies in required order/format from it.
     // --------------------------------------------------------------------------------------------------------------
     void execute(Inventory &inventory, CustomerHashTable &customers) const override;
 };
@@ -0,0 +1,46 @@
+// ----------------------------------------------- InventorySnapshot.cpp ----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Rendering of a point-in-time inventory view (see InventorySnapshot.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "InventorySnapshot.h"
+#include "Output.h"
+#include <utility>    // std::move
+
+// ------------------------------------------------ InventorySnapshot -------------------------------------------------
+InventorySnapshot::InventorySnapshot(std::shared_ptr<const Catalog> catalog, std::shared_ptr<const StockTable> stock)
+    : catalog(std::move(catalog)),
+      stock(std::move(stock))
+{
+}
+
+// ----------------------------------------------------- stockOf ------------------------------------------------------
+int InventorySnapshot::stockOf(const Movie *movie) const
+{
+    const size_t slot = static_cast<size_t>(movie->getSlot());
+    return (*(*stock)[slot / CHUNK_SIZE])[slot % CHUNK_SIZE];
+}
+
+// ----------------------------------------------------- display ------------------------------------------------------
+void InventorySnapshot::display() const
+{
+    for (const auto &section : *catalog)
+    {
+        if (section.movies.empty()) continue;
+
+        Output::out() << "=== " << section.label << " ===" << std::endl;
+        for (const Movie *m : section.movies)
+        {
+            m->print(stockOf(m));
+        }
+    }
+}
+
+// ---------------------------------------------------- getCatalog ----------------------------------------------------
+const InventorySnapshot::Catalog& InventorySnapshot::getCatalog() const
+{
+    return *catalog;
+}
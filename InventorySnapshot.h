@@ -0,0 +1,62 @@
+// ------------------------------------------------ InventorySnapshot.h -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Immutable point-in-time view of the inventory used by read-only commands (I). Taking one is O(1): it
+//          only copies two shared pointers, one to the catalog order and one to the current stock version.
+// Notes  : - Stock lives in a copy-on-write table of fixed-size chunks indexed by Movie::getSlot(). Inventory
+//            writes in place while no snapshot references the current version; otherwise it copies the chunk
+//            pointer array plus the one chunk being written, so readers keep the version they started with.
+//          - Old versions are reclaimed by reference counting when the last snapshot using them is released.
+//          - Movie objects are never deleted while the Inventory lives, so a snapshot may reference them for
+//            their immutable descriptive fields (title, director, ...).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef INVENTORYSNAPSHOT_H
+#define INVENTORYSNAPSHOT_H
+
+#include "movie.h"
+#include <array>      // fixed-size stock chunks
+#include <cstddef>    // size_t
+#include <memory>     // std::shared_ptr versions
+#include <string>
+#include <vector>
+
+class InventorySnapshot
+{
+public:
+    static const size_t CHUNK_SIZE = 256;
+
+    using StockChunk = std::array<int, CHUNK_SIZE>;
+    using StockTable = std::vector<std::shared_ptr<StockChunk>>;
+
+    // One display section: category code, heading, and its movies in sorted order.
+    struct Section
+    {
+        char                      category;
+        std::string               label;
+        std::vector<const Movie*> movies;
+    };
+    using Catalog = std::vector<Section>;
+
+    InventorySnapshot(std::shared_ptr<const Catalog> catalog, std::shared_ptr<const StockTable> stock);
+
+    // ------------------------------------------------- stockOf ------------------------------------------------------
+    // Description: Stock of 'movie' as of the snapshot.
+    int stockOf(const Movie *movie) const;
+
+    // ------------------------------------------------- display ------------------------------------------------------
+    // Description: Print the inventory in the same order/format as Inventory::displayInventory().
+    void display() const;
+
+    // ------------------------------------------------ getCatalog ----------------------------------------------------
+    // Description: Catalog order as of the snapshot (sections in display order, movies sorted within each).
+    const Catalog& getCatalog() const;
+
+private:
+    std::shared_ptr<const Catalog>    catalog;
+    std::shared_ptr<const StockTable> stock;
+};
+
+#endif // INVENTORYSNAPSHOT_H
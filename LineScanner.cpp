@@ -0,0 +1,364 @@
+// -------------------------------------------------- LineScanner.cpp -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : 64-byte block classifiers (AVX2 / SSE2 / scalar) with runtime dispatch, the scans built on them, and the
+//           chunked LineReader (see LineScanner.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "LineScanner.h"
+
+#include <cstdlib>    // std::getenv
+#include <cstring>    // std::memmove
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LINESCANNER_X86 1
+#include <immintrin.h>
+#endif
+
+static const size_t BLOCK = 64;
+
+// ---------------------------------------------------- kernels -------------------------------------------------------
+// Each kernel classifies exactly 64 bytes: bit i of the result describes p[i].
+struct Kernel
+{
+    uint64_t  (*eq)(const char *p, char c);   // p[i] == c
+    uint64_t  (*ws)(const char *p);           // p[i] is whitespace
+    const char *name;
+};
+
+static uint64_t eqScalar(const char *p, char c)
+{
+    uint64_t m = 0;
+    for (size_t i = 0; i < BLOCK; ++i) m |= uint64_t(p[i] == c) << i;
+    return m;
+}
+
+static uint64_t wsScalar(const char *p)
+{
+    uint64_t m = 0;
+    for (size_t i = 0; i < BLOCK; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(p[i]);
+        m |= uint64_t(c == ' ' || (c >= '\t' && c <= '\r')) << i;
+    }
+    return m;
+}
+
+#ifdef LINESCANNER_X86
+static uint64_t eqSse2(const char *p, char c)
+{
+    const __m128i needle = _mm_set1_epi8(c);
+    uint64_t m = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+        m |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)))) << (16 * k);
+    }
+    return m;
+}
+
+static uint64_t wsSse2(const char *p)
+{
+    // ' ' or '\t'..'\r': (c - 9) <= 4 unsigned, tested as min(x, 4) == x.
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab   = _mm_set1_epi8('\t');
+    const __m128i four  = _mm_set1_epi8(4);
+    uint64_t m = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+        const __m128i x = _mm_sub_epi8(v, tab);
+        const __m128i w = _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(_mm_min_epu8(x, four), x));
+        m |= uint64_t(static_cast<uint32_t>(_mm_movemask_epi8(w))) << (16 * k);
+    }
+    return m;
+}
+
+__attribute__((target("avx2"))) static uint64_t eqAvx2(const char *p, char c)
+{
+    const __m256i needle = _mm256_set1_epi8(c);
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    return uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle))))
+         | uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)))) << 32;
+}
+
+__attribute__((target("avx2"))) static uint64_t wsAvx2(const char *p)
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab   = _mm256_set1_epi8('\t');
+    const __m256i four  = _mm256_set1_epi8(4);
+    uint64_t m = 0;
+    for (int k = 0; k < 2; ++k)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * k));
+        const __m256i x = _mm256_sub_epi8(v, tab);
+        const __m256i w = _mm256_or_si256(_mm256_cmpeq_epi8(v, space),
+                                          _mm256_cmpeq_epi8(_mm256_min_epu8(x, four), x));
+        m |= uint64_t(static_cast<uint32_t>(_mm256_movemask_epi8(w))) << (32 * k);
+    }
+    return m;
+}
+#endif
+
+static Kernel pickKernel()
+{
+    const Kernel scalar{&eqScalar, &wsScalar, "scalar"};
+    const char *cap = std::getenv("MOVIES_SIMD");
+    const std::string limit = cap ? cap : "";
+    if (limit == "scalar") return scalar;
+
+#ifdef LINESCANNER_X86
+    __builtin_cpu_init();
+    if (limit != "sse2" && __builtin_cpu_supports("avx2")) return Kernel{&eqAvx2, &wsAvx2, "avx2"};
+    if (__builtin_cpu_supports("sse2"))                    return Kernel{&eqSse2, &wsSse2, "sse2"};
+#endif
+    return scalar;
+}
+
+static const Kernel& kernel()
+{
+    static const Kernel active = pickKernel();
+    return active;
+}
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline uint64_t lowBits(size_t n)
+{
+    return n >= BLOCK ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+static inline int lowest(uint64_t m)
+{
+    return __builtin_ctzll(m);
+}
+
+static inline bool isSpace(unsigned char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// Classify n <= 64 bytes. A short tail is classified byte by byte rather than read as a whole block, since the
+// bytes past it may not belong to the caller.
+static inline uint64_t eqBlock(const char *p, size_t n, char c)
+{
+    if (n >= BLOCK) return kernel().eq(p, c);
+    uint64_t m = 0;
+    for (size_t i = 0; i < n; ++i) m |= uint64_t(p[i] == c) << i;
+    return m;
+}
+
+// Same for whitespace, except bits past n are set (the end of input counts as whitespace).
+static inline uint64_t wsBlock(const char *p, size_t n)
+{
+    if (n >= BLOCK) return kernel().ws(p);
+    uint64_t m = ~lowBits(n);
+    for (size_t i = 0; i < n; ++i) m |= uint64_t(isSpace(static_cast<unsigned char>(p[i]))) << i;
+    return m;
+}
+
+// Append base + i + (each set bit of m) to out.
+static inline void collect(uint64_t m, size_t i, uint32_t base, std::vector<uint32_t> &out)
+{
+    while (m)
+    {
+        out.push_back(base + static_cast<uint32_t>(i + static_cast<size_t>(lowest(m))));
+        m &= m - 1;
+    }
+}
+
+// --------------------------------------------------- LineScanner ----------------------------------------------------
+const char* LineScanner::isaName()
+{
+    return kernel().name;
+}
+
+size_t LineScanner::find(const char *data, size_t n, char c)
+{
+    for (size_t i = 0; i < n; i += BLOCK)
+    {
+        const uint64_t m = eqBlock(data + i, n - i, c);
+        if (m) return i + static_cast<size_t>(lowest(m));
+    }
+    return n;
+}
+
+size_t LineScanner::delimiters(std::string_view line, char delim, uint32_t *offsets, size_t max)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < line.size() && count < max; i += BLOCK)
+    {
+        uint64_t m = eqBlock(line.data() + i, line.size() - i, delim);
+        while (m && count < max)
+        {
+            offsets[count++] = static_cast<uint32_t>(i + static_cast<size_t>(lowest(m)));
+            m &= m - 1;
+        }
+    }
+    return count;
+}
+
+void LineScanner::tokens(std::string_view line, std::vector<std::string_view> &out)
+{
+    // Token starts: non-whitespace after whitespace; token ends: whitespace after non-whitespace. prevWord carries
+    // the last byte's class across blocks.
+    uint64_t prevWord = 0;
+    size_t   start    = 0;
+    bool     open     = false;
+    for (size_t i = 0; i < line.size(); i += BLOCK)
+    {
+        const uint64_t word    = ~wsBlock(line.data() + i, line.size() - i);
+        const uint64_t shifted = (word << 1) | prevWord;
+        uint64_t edges = (word & ~shifted) | (~word & shifted);
+        prevWord = word >> 63;
+
+        while (edges)
+        {
+            const size_t pos = i + static_cast<size_t>(lowest(edges));
+            if (!open) start = pos;
+            else       out.push_back(line.substr(start, pos - start));
+            open = !open;
+            edges &= edges - 1;
+        }
+    }
+    if (open) out.push_back(line.substr(start));
+}
+
+std::string_view LineScanner::trim(std::string_view line)
+{
+    // Padding is a byte or two at either end, so this stays a plain loop.
+    size_t first = 0;
+    size_t last  = line.size();
+    while (first < last && isSpace(static_cast<unsigned char>(line[first]))) ++first;
+    while (last > first && isSpace(static_cast<unsigned char>(line[last - 1]))) --last;
+    return line.substr(first, last - first);
+}
+
+void LineScanner::index(const char *data, size_t n, uint32_t base, char delim,
+                        std::vector<uint32_t> &newlines, std::vector<uint32_t> &delims)
+{
+    const Kernel &k = kernel();
+    for (size_t i = 0; i < n; i += BLOCK)
+    {
+        const uint64_t valid = lowBits(n - i);
+        collect(k.eq(data + i, '\n') & valid, i, base, newlines);
+        if (delim != '\0') collect(k.eq(data + i, delim) & valid, i, base, delims);
+    }
+}
+
+// ---------------------------------------------------- LineReader ----------------------------------------------------
+LineReader::LineReader(char delim)
+    : in(nullptr),
+      delim(delim),
+      begin(0),
+      end(0),
+      eof(true),
+      consumed(0),
+      nextNewline(0),
+      nextDelim(0)
+{
+}
+
+bool LineReader::open(const std::string &filename)
+{
+    file.reset(new std::ifstream(filename, std::ios::binary));
+    if (!*file) return false;
+    attach(*file);
+    return true;
+}
+
+void LineReader::attach(std::istream &stream)
+{
+    in       = &stream;
+    eof      = false;
+    consumed = 0;
+    reset();
+    if (buffer.empty()) buffer.resize(BUFFER_SIZE + BLOCK);
+}
+
+bool LineReader::seek(std::streamoff offset)
+{
+    if (!in) return false;
+    in->clear();
+    in->seekg(offset);
+    eof      = !*in;
+    consumed = offset;
+    reset();
+    return !eof;
+}
+
+void LineReader::reset()
+{
+    begin = end = 0;
+    newlines.clear();
+    delims.clear();
+    lineFields.clear();
+    nextNewline = nextDelim = 0;
+}
+
+// ------------------------------------------------------- next -------------------------------------------------------
+bool LineReader::next(std::string_view &line)
+{
+    while (nextNewline == newlines.size() && fill())
+    {
+    }
+
+    // The line ends at the next indexed newline, or at the end of input for a last line without one.
+    const bool   terminated = nextNewline < newlines.size();
+    const size_t stop       = terminated ? newlines[nextNewline++] : end;
+    if (!terminated && begin == end) return false;
+
+    lineFields.clear();
+    while (nextDelim < delims.size() && delims[nextDelim] < stop)
+    {
+        lineFields.push_back(delims[nextDelim++] - static_cast<uint32_t>(begin));
+    }
+
+    line      = std::string_view(buffer.data() + begin, stop - begin);
+    const size_t after = terminated ? stop + 1 : stop;
+    consumed += static_cast<std::streamoff>(after - begin);
+    begin     = after;
+    return true;
+}
+
+const std::vector<uint32_t>& LineReader::fields() const
+{
+    return lineFields;
+}
+
+bool LineReader::fill()
+{
+    if (eof || !in) return false;
+
+    // Only called once every indexed newline is used up, so what remains is part of one line: move it (and its
+    // delimiter offsets) to the front. A line longer than the buffer doubles it.
+    if (begin > 0)
+    {
+        std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+        delims.erase(delims.begin(), delims.begin() + static_cast<std::ptrdiff_t>(nextDelim));
+        for (uint32_t &d : delims) d -= static_cast<uint32_t>(begin);
+        end  -= begin;
+        begin = 0;
+    }
+    newlines.clear();
+    nextNewline = nextDelim = 0;
+    if (end + BLOCK == buffer.size()) buffer.resize((buffer.size() - BLOCK) * 2 + BLOCK);
+
+    in->read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - BLOCK - end));
+    const size_t got = static_cast<size_t>(in->gcount());
+    if (got == 0)
+    {
+        eof = true;
+        return false;
+    }
+    LineScanner::index(buffer.data() + end, got, static_cast<uint32_t>(end), delim, newlines, delims);
+    end += got;
+    return true;
+}
+
+std::streamoff LineReader::offset() const
+{
+    return consumed;
+}
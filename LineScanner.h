@@ -0,0 +1,115 @@
+// -------------------------------------------------- LineScanner.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Shared byte-scanning kernel for the text loaders (movies, customers, commands, store manifests).
+//          LineScanner classifies 64-byte blocks at a time into bitmasks (one bit per byte equal to a delimiter,
+//          or one bit per whitespace byte) and walks the set bits to find newlines, field delimiters and token
+//          boundaries. LineReader reads a stream in large chunks and indexes each chunk in one pass: the offsets
+//          of every newline and of every field delimiter, so loaders get lines and field offsets without
+//          rescanning them.
+// Notes  : - Kernels: AVX2 (2 x 32-byte compares per block), SSE2 (4 x 16) or scalar, picked once at first use
+//            from the running CPU. MOVIES_SIMD=avx2|sse2|scalar in the environment caps the choice (for testing
+//            and benchmarking the paths against each other).
+//          - Whitespace means ' ', '\t', '\n', '\v', '\f', '\r' (the std::isspace set in the "C" locale).
+//          - Spans shorter than a block (a short line's tail) are classified by a scalar loop; only LineReader's
+//            own buffer, which has a block of slack past its data, is scanned in whole blocks to the end.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef LINESCANNER_H
+#define LINESCANNER_H
+
+#include <cstddef>       // size_t
+#include <cstdint>       // uint32_t offsets
+#include <fstream>       // LineReader's own file
+#include <istream>
+#include <memory>        // std::unique_ptr
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ---------------------------------------------------- LineScanner ---------------------------------------------------
+class LineScanner
+{
+public:
+    // Description: Name of the active kernel: "avx2", "sse2" or "scalar".
+    static const char* isaName();
+
+    // ----------------------------------------------------- find -----------------------------------------------------
+    // Description: Index of the first byte equal to c in [data, data + n), or n.
+    static size_t find(const char *data, size_t n, char c);
+
+    // -------------------------------------------------- delimiters --------------------------------------------------
+    // Description: Offsets (into line) of the first 'max' bytes equal to delim, in order.
+    // Returns    : How many were stored.
+    static size_t delimiters(std::string_view line, char delim, uint32_t *offsets, size_t max);
+
+    // ---------------------------------------------------- tokens ----------------------------------------------------
+    // Description: Append each maximal run of non-whitespace bytes in line to out.
+    static void tokens(std::string_view line, std::vector<std::string_view> &out);
+
+    // ----------------------------------------------------- trim -----------------------------------------------------
+    // Description: line without leading/trailing whitespace.
+    static std::string_view trim(std::string_view line);
+
+    // ---------------------------------------------------- index -----------------------------------------------------
+    // Description: Append the offsets (relative to data, plus base) of every '\n' to newlines and, if delim is not
+    //              '\0', of every delim byte to delims. Reads whole 64-byte blocks: data must stay readable up to
+    //              the next multiple of 64 past n (bytes past n are ignored).
+    static void index(const char *data, size_t n, uint32_t base, char delim,
+                      std::vector<uint32_t> &newlines, std::vector<uint32_t> &delims);
+};
+
+// ---------------------------------------------------- LineReader ----------------------------------------------------
+// Reads a stream in BUFFER_SIZE chunks and hands out lines as views into the buffer, with the same line split as
+// std::getline (no empty line after a final '\n'). Tracks the byte offset just past each returned line. With a
+// delimiter, fields() gives the offsets of that byte within the current line (e.g. ',' for the movies file).
+// --------------------------------------------------------------------------------------------------------------------
+class LineReader
+{
+public:
+    static constexpr size_t BUFFER_SIZE = 1 << 20;
+
+    explicit LineReader(char delim = '\0');
+
+    // Description: Open a file for reading (owned by the reader). Returns false if it cannot be opened.
+    bool open(const std::string &filename);
+
+    // Description: Read from an existing stream (not owned) from its current position.
+    void attach(std::istream &in);
+
+    // Description: Continue from byte offset 'offset' of the opened file.
+    bool seek(std::streamoff offset);
+
+    // ----------------------------------------------------- next -----------------------------------------------------
+    // Description: Next line without its '\n'; the view stays valid until the next call.
+    // Returns    : false at end of input.
+    bool next(std::string_view &line);
+
+    // Description: Offsets of the delimiter bytes in the line last returned by next(), in order.
+    const std::vector<uint32_t>& fields() const;
+
+    // Description: Byte offset just past the last line returned (including its newline, if it had one).
+    std::streamoff offset() const;
+
+private:
+    void reset();
+    bool fill();   // read and index more input after the unread tail; false at end of input
+
+    std::unique_ptr<std::ifstream> file;
+    std::istream                  *in;
+    char                           delim;
+    std::vector<char>              buffer;       // data + one block of slack for whole-block indexing
+    size_t                         begin;        // first unread byte
+    size_t                         end;          // one past the last buffered byte
+    bool                           eof;
+    std::streamoff                 consumed;     // stream offset of buffer[begin]
+    std::vector<uint32_t>          newlines;     // buffer offsets of unread '\n's
+    size_t                         nextNewline;
+    std::vector<uint32_t>          delims;       // buffer offsets of unread delimiters
+    size_t                         nextDelim;
+    std::vector<uint32_t>          lineFields;   // current line's delimiter offsets
+};
+
+#endif // LINESCANNER_H
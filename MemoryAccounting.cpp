@@ -0,0 +1,106 @@
+// ----------------------------------------------- MemoryAccounting.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Per-category current/peak byte counters and the footprint report (see MemoryAccounting.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "MemoryAccounting.h"
+
+#include <atomic>
+#include <string>    // std::to_string
+#include <iomanip>   // column alignment
+
+struct Counter
+{
+    std::atomic<size_t> current{0};
+    std::atomic<size_t> peak{0};
+};
+
+// Constant-initialized with trivial destructors, so containers released during static destruction (the string
+// pool's stripes) can still account safely. The extra slot is the tracked total.
+static Counter COUNTERS[static_cast<int>(MemCategory::COUNT) + 1];
+static Counter &TOTAL = COUNTERS[static_cast<int>(MemCategory::COUNT)];
+
+struct CategoryInfo
+{
+    const char *label;
+    bool        inTotal;   // false = bytes already counted by another category
+};
+
+static const CategoryInfo CATEGORIES[] = {
+    {"inventory map nodes",          true},
+    {"movie objects",                true},
+    {"  inventory keys (in pool)",   false},
+    {"customer table buckets+nodes", true},
+    {"customer objects",             true},
+    {"customer history entries",     true},
+    {"customer borrowed sets",       true},
+    {"customer name index",          true},
+    {"string pool",                  true},
+};
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static void raise(Counter &c, size_t bytes)
+{
+    const size_t now = c.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    size_t seen = c.peak.load(std::memory_order_relaxed);
+    while (now > seen && !c.peak.compare_exchange_weak(seen, now, std::memory_order_relaxed))
+    {
+    }
+}
+
+static std::string bytesOf(size_t bytes)
+{
+    return std::to_string(bytes) + " B";
+}
+
+// ---------------------------------------------------- add / sub -----------------------------------------------------
+void MemoryAccounting::add(MemCategory category, size_t bytes)
+{
+    raise(COUNTERS[static_cast<int>(category)], bytes);
+    if (CATEGORIES[static_cast<int>(category)].inTotal) raise(TOTAL, bytes);
+}
+
+void MemoryAccounting::sub(MemCategory category, size_t bytes)
+{
+    COUNTERS[static_cast<int>(category)].current.fetch_sub(bytes, std::memory_order_relaxed);
+    if (CATEGORIES[static_cast<int>(category)].inTotal) TOTAL.current.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::current(MemCategory category)
+{
+    return COUNTERS[static_cast<int>(category)].current.load(std::memory_order_relaxed);
+}
+
+size_t MemoryAccounting::peak(MemCategory category)
+{
+    return COUNTERS[static_cast<int>(category)].peak.load(std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------ report ------------------------------------------------------
+void MemoryAccounting::report(std::ostream &out, const std::string &prefix, size_t titles, size_t customers)
+{
+    out << prefix << std::left << std::setw(30) << "structure" << std::right << std::setw(14) << "current"
+        << std::setw(14) << "peak" << "\n";
+    for (int i = 0; i < static_cast<int>(MemCategory::COUNT); ++i)
+    {
+        out << prefix << std::left << std::setw(30) << CATEGORIES[i].label << std::right
+            << std::setw(14) << bytesOf(COUNTERS[i].current.load(std::memory_order_relaxed))
+            << std::setw(14) << bytesOf(COUNTERS[i].peak.load(std::memory_order_relaxed)) << "\n";
+    }
+    out << prefix << std::left << std::setw(30) << "tracked total" << std::right
+        << std::setw(14) << bytesOf(TOTAL.current.load(std::memory_order_relaxed))
+        << std::setw(14) << bytesOf(TOTAL.peak.load(std::memory_order_relaxed)) << "\n";
+
+    // Per-title cost: map node + object (key text is shared through the string pool, so it is not added again);
+    // per-customer cost: table share + object + history + borrowed set + name index node.
+    const size_t perTitle    = current(MemCategory::INVENTORY_MAP) + current(MemCategory::MOVIES);
+    const size_t perCustomer = current(MemCategory::CUSTOMER_TABLE) + current(MemCategory::CUSTOMERS)
+                             + current(MemCategory::HISTORY) + current(MemCategory::BORROWED)
+                             + current(MemCategory::NAME_INDEX);
+    out << prefix << "per title: " << (titles ? perTitle / titles : 0) << " B (" << titles << " titles) | "
+        << "per customer: " << (customers ? perCustomer / customers : 0) << " B (" << customers << " customers)"
+        << std::endl;
+}
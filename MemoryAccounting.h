@@ -0,0 +1,101 @@
+// ------------------------------------------------ MemoryAccounting.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Process-wide memory accounting by structure. Containers attribute their node and bucket allocations
+//          through CountingAllocator; Movie and Customer objects through class-level operator new/delete; the
+//          string pool its arena blocks. Each category keeps current and peak bytes, and report() prints the
+//          breakdown (M command, and at exit) with bytes per title and per customer.
+// Notes  : - Counters are relaxed atomics, so loaders and store shards on other threads account without locks.
+//          - Inventory keys live in the string pool; their bytes are shown as a part of it, not added twice, and
+//            are left out of the per-title figure. Each Inventory releases its keys' share when destroyed.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef MEMORYACCOUNTING_H
+#define MEMORYACCOUNTING_H
+
+#include <cstddef>   // size_t
+#include <memory>    // std::allocator
+#include <ostream>
+#include <string>
+
+enum class MemCategory : int
+{
+    INVENTORY_MAP,    // Inventory::inventoryMap nodes
+    MOVIES,           // Movie / Classics / ... objects
+    KEYS,             // key text referenced by live inventories (part of STRING_POOL)
+    CUSTOMER_TABLE,   // CustomerHashTable buckets + nodes
+    CUSTOMERS,        // Customer objects
+    HISTORY,          // Customer history entries and their text
+    BORROWED,         // Customer::borrowedMovies sets
+    NAME_INDEX,       // CustomerNameIndex nodes
+    STRING_POOL,      // StringPool arena blocks + lookup tables
+    COUNT
+};
+
+class MemoryAccounting
+{
+public:
+    // --------------------------------------------------- add / sub --------------------------------------------------
+    // Description: Attribute (release) bytes to a category; updates its peak and the tracked-total peak.
+    static void add(MemCategory category, size_t bytes);
+    static void sub(MemCategory category, size_t bytes);
+
+    static size_t current(MemCategory category);
+    static size_t peak(MemCategory category);
+
+    // ---------------------------------------------------- report ----------------------------------------------------
+    // Description: One line per category (current and peak bytes), the tracked total, then bytes per title and per
+    //              customer. Every line starts with prefix.
+    static void report(std::ostream &out, const std::string &prefix, size_t titles, size_t customers);
+};
+
+// ------------------------------------------------ CountingAllocator -------------------------------------------------
+// std::allocator that attributes every allocation to category C; use it as a container's allocator parameter.
+// --------------------------------------------------------------------------------------------------------------------
+template <typename T, MemCategory C>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = CountingAllocator<U, C>;
+    };
+
+    CountingAllocator() noexcept = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U, C> &) noexcept
+    {
+    }
+
+    T* allocate(size_t n)
+    {
+        T *p = std::allocator<T>().allocate(n);
+        MemoryAccounting::add(C, n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        MemoryAccounting::sub(C, n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U, C> &) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const CountingAllocator<U, C> &) const noexcept
+    {
+        return false;
+    }
+};
+
+#endif // MEMORYACCOUNTING_H
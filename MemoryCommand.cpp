@@ -0,0 +1,15 @@
+// ------------------------------------------------ MemoryCommand.cpp -------------------------------------------------
+// Prints the memory-accounting breakdown; per-title and per-customer figures use this store's counts.
+
+#include "MemoryCommand.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "MemoryAccounting.h"
+#include "Output.h"
+#include <iostream>
+
+void MemoryCommand::execute(Inventory &inventory, CustomerHashTable &customers) const
+{
+    Output::out() << "=== Memory (process-wide) ===" << std::endl;
+    MemoryAccounting::report(Output::out(), "  ", static_cast<size_t>(inventory.getTitleCount()), customers.size());
+}
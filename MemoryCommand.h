@@ -0,0 +1,29 @@
+// ------------------------------------------------- MemoryCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command ("M") that prints the per-structure memory footprint from MemoryAccounting: current and peak
+//          bytes for inventory map nodes, movie objects, keys, the customer table, customer objects, histories,
+//          borrowed sets and the string pool, plus bytes per title and per customer.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef MEMORYCOMMAND_H
+#define MEMORYCOMMAND_H
+
+#include "Command.h"
+
+class MemoryCommand : public Command
+{
+public:
+    MemoryCommand() = default;
+    ~MemoryCommand() override = default;
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "=== Memory (process-wide) ===" followed by the MemoryAccounting report.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+};
+
+#endif // MEMORYCOMMAND_H
@@ -1,17 +1,21 @@
 // ------------------------------------------- MovieFactory.cpp -------------------------------------------------------
 // Programmer: <Clayton McArthur>   
 // Creation Date: <2025-08-15>
-// Last Modified: <2025-08-24>
+// Last Modified: <2026-10-19>
 // --------------------------------------------------------------------------------------------------------------------
-// Purpose: Implements enum-based creation of derived Movie objects. Returns nullptr with an error message for
-//          unrecognized genres.
+// Purpose: Implements enum- and table-based creation of derived Movie objects, plus key building for command
+//          descriptors. Returns nullptr with an error message for unrecognized genres.
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "MovieFactory.h"
 #include "comedy.h"
 #include "drama.h"
 #include "classics.h"
-#include <iostream>  // std::cerr for error reporting
+#include "documentary.h"
+#include "foreign.h"
+#include "Output.h"
+#include <iostream>  // std::endl for error reporting
+#include <sstream>   // key formatting
 
 // ------------------------------------------ createMovie(enum) -------------------------------------------------------
 Movie* MovieFactory::createMovie(const MovieGenre genre)
@@ -32,10 +36,65 @@ Movie* MovieFactory::createMovie(const MovieGenre genre)
             m = new Classics();
             break;
 
+        case DOCUMENTARY:
+            m = new Documentary();
+            break;
+
+        case FOREIGN:
+            m = new Foreign();
+            break;
+
         default:
-            std::cerr << "ERROR: invalid MovieGenre in MovieFactory::createMovie" << std::endl;
+            Output::err() << "ERROR: invalid MovieGenre in MovieFactory::createMovie" << std::endl;
             return nullptr;
     }
 
     return m;
 } // end of createMovie(enum)
+
+
+// ------------------------------------------ createMovie(char) -------------------------------------------------------
+Movie* MovieFactory::createMovie(char code, const MovieParams &params)
+{
+    const GenreInfo *genre = findGenre(code);
+    if (!genre)
+    {
+        Output::err() << "ERROR: invalid movie code '" << code << "' in MovieFactory::createMovie" << std::endl;
+        return nullptr;
+    }
+    return genre->create(params);
+} // end of createMovie(char)
+
+// ------------------------------------------------- keyFor -----------------------------------------------------------
+std::string MovieFactory::keyFor(char code, const std::string &title, int year,
+                                 const std::string &director, int month, const std::string &actor)
+{
+    const GenreInfo *genre = findGenre(code);
+    if (!genre) return "";
+
+    switch (genre->shape)
+    {
+        case KeyShape::TITLE_YEAR:
+        {
+            std::ostringstream oss;
+            oss << title << "|" << year;
+            return oss.str();
+        }
+
+        case KeyShape::DIRECTOR_TITLE:
+            return director + "|" + title;
+
+        case KeyShape::DATE_ACTOR:
+        default:
+        {
+            std::string key = std::to_string(year);
+            key.reserve(key.size() + 4 + actor.size());
+            key += '-';
+            if (month < 10) key += '0';
+            key += std::to_string(month);
+            key += '|';
+            key += actor;
+            return key;
+        }
+    }
+} // end of keyFor
@@ -1,12 +1,16 @@
 // ------------------------------------------- MovieFactory.h ---------------------------------------------------------
 // Programmer: <Clayton McArthur>  
 // Creation Date: <2025-08-15>
-// Last Modified: <2025-08-24>
+// Last Modified: <2026-10-19>
 // --------------------------------------------------------------------------------------------------------------------
 // Purpose: Factory for creating Movie-derived objects. Supports two styles:
-//          1) Enum-based creation (COMEDY/DRAMA/CLASSICS).
-//          2) (Optional) Registry-based creation by category char, using MovieParams.
-// Notes  : Registry methods are declared here but can be unused if enum creation is sufficient.
+//          1) Enum-based creation (COMEDY/DRAMA/CLASSICS/DOCUMENTARY/FOREIGN).
+//          2) Genre-table creation by category char, either from MovieParams or from a movies-file line tail.
+// Notes  : - The genre table is a constexpr array plus a constexpr code->index table, so resolving a code is one
+//            array load and the per-genre parser/constructor are plain function pointers (no std::function or map
+//            lookups per line).
+//          - To add a genre: write its Movie subclass with a static parse(), then add one GENRE_TABLE row. The
+//            loader, inventory display order, and borrow/return parsing all pick it up from the table.
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef MOVIEFACTORY_H
@@ -16,12 +20,14 @@
 #include "comedy.h"
 #include "drama.h"
 #include "classics.h"
+#include "documentary.h"
+#include "foreign.h"
 
-#include <functional> // std::function for optional registry callbacks
-#include <map>        // std::map for optional code->creator registry
+#include <array>      // constexpr code->index table
+#include <cstddef>    // size_t
 #include <string>     // std::string fields in MovieParams
 
-// Bundles parameters for potential registry-based creation.
+// Bundles parameters for table-based creation.
 struct MovieParams {
     std::string title;
     int         stock;
@@ -29,33 +35,100 @@ struct MovieParams {
     int         year;
     int         month;        // classics-only
     std::string majorActor;   // classics-only (full name)
+    std::string language;     // foreign-only
 };
 
 enum MovieGenre {
     COMEDY,
     DRAMA,
-    CLASSICS
+    CLASSICS,
+    DOCUMENTARY,
+    FOREIGN
 };
 
+// How commands describe a title of a genre, and therefore how its inventory key is formed.
+enum class KeyShape {
+    TITLE_YEAR,       // "Title, Year"            -> "Title|Year"
+    DIRECTOR_TITLE,   // "Director, Title,"       -> "Director|Title"
+    DATE_ACTOR        // "Month Year First Last"  -> "YYYY-MM|First Last"
+};
+
+// Parses the genre-specific tail of a movies-file line; returns nullptr and sets 'error' on failure.
+using GenreParser  = Movie* (*)(const std::string &title, int stock, const std::string &director,
+                                const std::string &tail, std::string &error);
+using GenreCreator = Movie* (*)(const MovieParams &params);
+
+struct GenreInfo {
+    char         code;
+    const char  *label;    // inventory section heading
+    KeyShape     shape;
+    GenreParser  parse;
+    GenreCreator create;
+};
+
+// ------------------------------------------------- GENRE_TABLE ------------------------------------------------------
+// Rows are in inventory display order.
+// --------------------------------------------------------------------------------------------------------------------
+inline constexpr GenreInfo GENRE_TABLE[] = {
+    {'F', "Comedy",      KeyShape::TITLE_YEAR,     &Comedy::parse,
+        [](const MovieParams &p) -> Movie* { return new Comedy(p.title, p.stock, p.director, p.year); }},
+    {'D', "Drama",       KeyShape::DIRECTOR_TITLE, &Drama::parse,
+        [](const MovieParams &p) -> Movie* { return new Drama(p.title, p.stock, p.director, p.year); }},
+    {'C', "Classics",    KeyShape::DATE_ACTOR,     &Classics::parse,
+        [](const MovieParams &p) -> Movie*
+        {
+            const size_t sp = p.majorActor.find(' ');
+            const std::string first = p.majorActor.substr(0, sp);
+            const std::string last  = (sp == std::string::npos) ? "" : p.majorActor.substr(sp + 1);
+            return new Classics(p.title, p.stock, p.director, p.month, p.year, first, last);
+        }},
+    {'N', "Documentary", KeyShape::TITLE_YEAR,     &Documentary::parse,
+        [](const MovieParams &p) -> Movie* { return new Documentary(p.title, p.stock, p.director, p.year); }},
+    {'W', "Foreign",     KeyShape::DIRECTOR_TITLE, &Foreign::parse,
+        [](const MovieParams &p) -> Movie*
+        {
+            return new Foreign(p.title, p.stock, p.director, p.year, p.language);
+        }},
+};
+
+inline constexpr size_t GENRE_COUNT = sizeof(GENRE_TABLE) / sizeof(GENRE_TABLE[0]);
+
+// ASCII code -> row in GENRE_TABLE, or -1. Built at compile time.
+inline constexpr std::array<signed char, 128> GENRE_INDEX = []()
+{
+    std::array<signed char, 128> idx{};
+    for (auto &v : idx) v = -1;
+    for (size_t i = 0; i < GENRE_COUNT; ++i)
+    {
+        idx[static_cast<unsigned char>(GENRE_TABLE[i].code)] = static_cast<signed char>(i);
+    }
+    return idx;
+}();
+
 class MovieFactory {
 public:
-    // --------------------------------------------- registerGenre ----------------------------------------------------
-    // Description: Register a creator function for a given category code (e.g., 'F','D','C').
-    // Note: Optional — only needed if using the registry path.
-    static void registerGenre(char code,
-        std::function<Movie*(const MovieParams&)> creator);
+    // ----------------------------------------------- findGenre ------------------------------------------------------
+    // Description: Table row for a category code, or nullptr if the code is not a known genre.
+    static const GenreInfo* findGenre(char code)
+    {
+        const unsigned char c = static_cast<unsigned char>(code);
+        if (c >= GENRE_INDEX.size() || GENRE_INDEX[c] < 0) return nullptr;
+        return &GENRE_TABLE[GENRE_INDEX[c]];
+    }
 
     // --------------------------------------------- createMovie (char) -----------------------------------------------
-    // Description: Create via char code using the registered factory map.
-    // Note: Optional — only needed if using the registry path.
+    // Description: Create via char code using the genre table. Returns nullptr (with an error) for unknown codes.
     static Movie* createMovie(char code, const MovieParams &params);
 
     // --------------------------------------------- createMovie (enum) -----------------------------------------------
     // Description: Create via enum (simple switch). Implemented in MovieFactory.cpp.
     static Movie* createMovie(const MovieGenre genre);
 
-private:
-    static std::map<char, std::function<Movie*(const MovieParams&)>>& getRegistry();
+    // ------------------------------------------------- keyFor -------------------------------------------------------
+    // Description: Build the inventory key for a command's descriptor fields, matching Movie::buildKey() for the
+    //              genre's KeyShape. Returns "" for unknown codes.
+    static std::string keyFor(char code, const std::string &title, int year,
+                              const std::string &director, int month, const std::string &actor);
 };
 
 #endif // MOVIEFACTORY_H
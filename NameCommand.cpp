@@ -0,0 +1,31 @@
+// ------------------------------------------------- NameCommand.cpp --------------------------------------------------
+// Lists customer ids for a surname prefix or an exact name through the customer name index.
+
+#include "NameCommand.h"
+#include "CustomerHashTable.h"
+#include "Output.h"
+#include <iostream>
+#include <vector>
+
+void NameCommand::execute(Inventory &, CustomerHashTable &customers) const
+{
+    // Ask for one extra match to know whether the list was cut off.
+    const CustomerNameIndex &index = customers.getNameIndex();
+    std::vector<int> ids = first.empty() ? index.findPrefix(last, limit + 1)
+                                         : index.findName(last, first, limit + 1);
+    const bool more = ids.size() > limit;
+    if (more) ids.pop_back();
+
+    Output::out() << "Name '" << last << (first.empty() ? "" : " ") << first << "':" << std::endl;
+    if (ids.empty())
+    {
+        Output::out() << "  (no matches)" << std::endl;
+        return;
+    }
+    for (int id : ids)
+    {
+        const Customer *c = customers.getCustomer(id);
+        Output::out() << "  " << id << " " << c->getLastName() << ", " << c->getFirstName() << std::endl;
+    }
+    if (more) Output::out() << "  (more)" << std::endl;
+}
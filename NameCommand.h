@@ -0,0 +1,42 @@
+// -------------------------------------------------- NameCommand.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Customer lookup by name ("N"): lists up to N customers whose surname starts with a prefix, or who have
+//          exactly a given surname and first name (case-insensitive). Line format: "N <N> <surnamePrefix>" or
+//          "N <N> <last> <first>".
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef NAMECOMMAND_H
+#define NAMECOMMAND_H
+
+#include "Command.h"
+#include <cstddef>   // size_t
+#include <string>
+
+class NameCommand : public Command
+{
+public:
+    // Description: An empty first name means last is a surname prefix.
+    NameCommand(size_t limit, const std::string &last, const std::string &first)
+        : limit(limit),
+          last(last),
+          first(first)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "Name '<query>':" followed by one "  <id> <last>, <first>" line per match (ordered by name, then
+    //       id), "  (more)" if more than N matched, or "  (no matches)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    size_t      limit;
+    std::string last;
+    std::string first;
+};
+
+#endif // NAMECOMMAND_H
@@ -0,0 +1,49 @@
+// ---------------------------------------------------- Output.cpp ----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Thread-local stream bindings used by all printing code (see Output.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "Output.h"
+#include <iostream>   // std::cout / std::cerr defaults
+
+// ------------------------------------------------ current bindings --------------------------------------------------
+std::ostream*& Output::currentOut()
+{
+    static thread_local std::ostream *os = &std::cout;
+    return os;
+}
+
+std::ostream*& Output::currentErr()
+{
+    static thread_local std::ostream *os = &std::cerr;
+    return os;
+}
+
+// --------------------------------------------------- out / err ------------------------------------------------------
+std::ostream& Output::out()
+{
+    return *currentOut();
+}
+
+std::ostream& Output::err()
+{
+    return *currentErr();
+}
+
+// ---------------------------------------------------- Redirect ------------------------------------------------------
+Output::Redirect::Redirect(std::ostream &out, std::ostream &err)
+    : prevOut(currentOut()),
+      prevErr(currentErr())
+{
+    currentOut() = &out;
+    currentErr() = &err;
+}
+
+Output::Redirect::~Redirect()
+{
+    currentOut() = prevOut;
+    currentErr() = prevErr;
+}
@@ -0,0 +1,49 @@
+// ----------------------------------------------------- Output.h -----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Indirection for the streams that movies, customers, commands and loaders print to. Defaults to
+//          std::cout / std::cerr; a Redirect scope rebinds them for the current thread only, so each store shard
+//          (or any worker) can write to its own files without locking the shared standard streams.
+// Notes  : Bindings are thread_local and restored in LIFO order when a Redirect is destroyed.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <ostream>   // std::ostream
+
+class Output
+{
+public:
+    // ---------------------------------------------------- out -------------------------------------------------------
+    // Description: Stream for normal program output (inventory listings, histories). Defaults to std::cout.
+    static std::ostream& out();
+
+    // ---------------------------------------------------- err -------------------------------------------------------
+    // Description: Stream for errors/diagnostics. Defaults to std::cerr.
+    static std::ostream& err();
+
+    // -------------------------------------------------- Redirect ----------------------------------------------------
+    // Description: RAII binding of out()/err() for the calling thread; restores the previous binding on scope exit.
+    class Redirect
+    {
+    public:
+        Redirect(std::ostream &out, std::ostream &err);
+        ~Redirect();
+
+        Redirect(const Redirect&) = delete;
+        Redirect& operator=(const Redirect&) = delete;
+
+    private:
+        std::ostream *prevOut;
+        std::ostream *prevErr;
+    };
+
+private:
+    static std::ostream*& currentOut();
+    static std::ostream*& currentErr();
+};
+
+#endif // OUTPUT_H
@@ -0,0 +1,70 @@
+// ---------------------------------------------- OutstandingCommand.cpp ----------------------------------------------
+// Prints outstanding loans straight from Inventory's per-title counters and holder index.
+
+#include "OutstandingCommand.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "Output.h"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+void OutstandingCommand::execute(Inventory &inventory, CustomerHashTable &customers) const
+{
+    if (customerId >= 0)
+    {
+        if (!customers.getCustomer(customerId))
+        {
+            Output::err() << "ERROR: Unknown customer ID " << customerId << std::endl;
+            return;
+        }
+
+        Output::out() << "Outstanding loans for customer " << customerId << ":" << std::endl;
+        const auto held = inventory.getCustomerLoans(customerId);
+        if (held.empty())
+        {
+            Output::out() << "  (no outstanding loans)" << std::endl;
+            return;
+        }
+        for (const auto &entry : held)
+        {
+            Output::out() << "  " << entry.second << " x | ";
+            entry.first->display();
+        }
+        return;
+    }
+
+    Output::out() << "Outstanding loans:" << std::endl;
+    const auto titles = inventory.getOutstandingTitles();
+    if (titles.empty())
+    {
+        Output::out() << "  (no outstanding loans)" << std::endl;
+    }
+    for (const Movie *movie : titles)
+    {
+        std::vector<std::pair<int, int>> holders(inventory.getHolders(movie).begin(),
+                                                 inventory.getHolders(movie).end());
+        std::sort(holders.begin(), holders.end());
+
+        Output::out() << "  " << inventory.getCheckedOut(movie) << " out | ";
+        movie->display();
+        Output::out() << "      held by:";
+        for (const auto &h : holders)
+        {
+            Output::out() << " " << h.first;
+            if (h.second > 1) Output::out() << " x" << h.second;
+        }
+        Output::out() << std::endl;
+    }
+    Output::out() << "  Copies: " << inventory.getShelfCopies() << " on shelf + "
+                  << inventory.getCheckedOutCopies() << " checked out = " << inventory.getTotalCopies()
+                  << (inventory.checkInvariant() ? " (ok)" : " (INVARIANT VIOLATED)") << std::endl;
+}
+
+CommandRefs OutstandingCommand::references() const
+{
+    CommandRefs refs;
+    refs.customerId = customerId;   // -1 for the per-title report
+    return refs;
+}
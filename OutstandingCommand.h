@@ -0,0 +1,38 @@
+// ----------------------------------------------- OutstandingCommand.h -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that reports outstanding loans from the inventory's checked-out counters, either per title
+//          ("O") or for one customer ("O <id>"), without scanning customer records.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef OUTSTANDINGCOMMAND_H
+#define OUTSTANDINGCOMMAND_H
+
+#include "Command.h"
+
+class OutstandingCommand : public Command
+{
+public:
+    // customerId < 0 = report every title with copies out
+    explicit OutstandingCommand(int customerId)
+        : customerId(customerId)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Per title: prints the copies out, the holders (id x copies) and the listing, then the shelf/checked-out
+    //       totals. Per customer: prints each held title with its copy count, or "  (no outstanding loans)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+    // Post: The customer id for "O <id>"; nothing for the per-title report.
+    CommandRefs references() const override;
+
+private:
+    int customerId;
+};
+
+#endif // OUTSTANDINGCOMMAND_H
@@ -0,0 +1,63 @@
+// ------------------------------------------------- PageCommand.cpp --------------------------------------------------
+// One page of a genre listing via Inventory::page(), with hex cursors.
+
+#include "PageCommand.h"
+#include "Inventory.h"
+#include "MovieFactory.h"
+#include "Output.h"
+#include <iostream>
+#include <vector>
+
+static const char HEX[] = "0123456789abcdef";
+
+static inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string PageCommand::encodeCursor(const std::string &key)
+{
+    std::string cursor;
+    cursor.reserve(key.size() * 2);
+    for (unsigned char c : key)
+    {
+        cursor += HEX[c >> 4];
+        cursor += HEX[c & 0x0F];
+    }
+    return cursor;
+}
+
+bool PageCommand::decodeCursor(const std::string &cursor, std::string &key)
+{
+    if (cursor.size() % 2 != 0) return false;
+
+    key.clear();
+    for (size_t i = 0; i < cursor.size(); i += 2)
+    {
+        const int hi = hexValue(cursor[i]);
+        const int lo = hexValue(cursor[i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        key += static_cast<char>((hi << 4) | lo);
+    }
+    return true;
+}
+
+void PageCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    // One extra row tells whether a next page exists without a second lookup.
+    std::vector<const Movie*> rows = inventory.page(category, afterKey, pageSize + 1);
+    const bool more = rows.size() > pageSize;
+    if (more) rows.pop_back();
+
+    Output::out() << "=== " << MovieFactory::findGenre(category)->label << " (page of " << pageSize << ") ==="
+                  << std::endl;
+    for (const Movie *m : rows)
+    {
+        m->display();
+    }
+    if (more) Output::out() << "  next: " << encodeCursor(rows.back()->buildKey()) << std::endl;
+    else      Output::out() << "  next: (end)" << std::endl;
+}
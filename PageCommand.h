@@ -0,0 +1,46 @@
+// -------------------------------------------------- PageCommand.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that prints one page of a genre's inventory plus a cursor for the next page.
+//          Line format: "G <genre> <pageSize> [cursor]". The cursor is opaque to clients (hex of the last
+//          canonical key shown); each page costs O(log n + pageSize) however deep it is.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef PAGECOMMAND_H
+#define PAGECOMMAND_H
+
+#include "Command.h"
+#include <cstddef>   // size_t
+#include <string>
+
+class PageCommand : public Command
+{
+public:
+    // afterKey: decoded cursor ("" = first page)
+    PageCommand(char category, size_t pageSize, const std::string &afterKey)
+        : category(category),
+          pageSize(pageSize),
+          afterKey(afterKey)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints a heading, up to pageSize listings in display order, then "  next: <cursor>" or "  next: (end)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+    // ------------------------------------------------ cursors -------------------------------------------------------
+    // Description: Opaque cursor <-> canonical key. decodeCursor returns false on malformed input.
+    static std::string encodeCursor(const std::string &key);
+    static bool        decodeCursor(const std::string &cursor, std::string &key);
+
+private:
+    char        category;
+    size_t      pageSize;
+    std::string afterKey;
+};
+
+#endif // PAGECOMMAND_H
@@ -0,0 +1,261 @@
+// ---------------------------------------------- PopularityTracker.cpp -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Count-min sketch, per-scope heavy-hitter tables and sliding-window counts (see PopularityTracker.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "PopularityTracker.h"
+#include "MovieFactory.h"
+
+#include <algorithm>  // std::sort, std::min
+#include <cstring>    // std::memset
+#include <sstream>    // checkpoint lines
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// Independent bucket per sketch row (multiply + xor-shift mix of the title's slot).
+static inline size_t bucket(const Movie *movie, size_t row)
+{
+    static const uint64_t SEEDS[PopularityTracker::SKETCH_DEPTH] =
+    {
+        0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0xD6E8FEB86659FD93ull
+    };
+    uint64_t x = (static_cast<uint64_t>(movie->getSlot()) + 1) * SEEDS[row];
+    x ^= x >> 29;
+    return static_cast<size_t>(x & (PopularityTracker::SKETCH_WIDTH - 1));
+}
+
+// ------------------------------------------------ PopularityTracker -------------------------------------------------
+PopularityTracker::PopularityTracker(uint64_t windowCommands)
+    : tables(1 + GENRE_COUNT),
+      windowCommands(windowCommands)
+{
+    std::memset(sketch, 0, sizeof(sketch));
+}
+
+// -------------------------------------------------- recordBorrow ----------------------------------------------------
+void PopularityTracker::recordBorrow(const Movie *movie, uint64_t seq)
+{
+    uint64_t est = UINT64_MAX;
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row)
+    {
+        uint32_t &c = sketch[row][bucket(movie, row)];
+        if (c != UINT32_MAX) ++c;
+        est = std::min<uint64_t>(est, c);
+    }
+
+    offer(tables[0], movie, est);
+    const GenreInfo *genre = MovieFactory::findGenre(movie->getCategory());
+    if (genre) offer(tables[1 + static_cast<size_t>(genre - GENRE_TABLE)], movie, est);
+
+    expire(seq);
+    windowEvents.emplace_back(seq, movie);
+    ++windowCounts[movie];
+}
+
+// ------------------------------------------------------ offer -------------------------------------------------------
+void PopularityTracker::offer(TopTable &table, const Movie *movie, uint64_t est)
+{
+    for (Slot &s : table.slots)
+    {
+        if (s.movie == movie)
+        {
+            s.count = est;
+            return;
+        }
+    }
+
+    if (table.slots.size() < TOP_K)
+    {
+        table.slots.push_back(Slot{movie, est});
+        if (table.slots.size() == TOP_K)
+        {
+            table.minCount = UINT64_MAX;
+            for (const Slot &s : table.slots) table.minCount = std::min(table.minCount, s.count);
+        }
+        return;
+    }
+
+    // Full table: minCount is a lower bound on the smallest count, so most long-tail titles stop here.
+    if (est <= table.minCount) return;
+
+    Slot *victim = &table.slots[0];
+    for (Slot &s : table.slots)
+    {
+        if (s.count < victim->count) victim = &s;
+    }
+    if (est <= victim->count)
+    {
+        table.minCount = victim->count;
+        return;
+    }
+
+    *victim = Slot{movie, est};
+    table.minCount = UINT64_MAX;
+    for (const Slot &s : table.slots) table.minCount = std::min(table.minCount, s.count);
+}
+
+// ----------------------------------------------------- expire -------------------------------------------------------
+void PopularityTracker::expire(uint64_t now)
+{
+    while (!windowEvents.empty() && windowEvents.front().first + windowCommands <= now)
+    {
+        auto it = windowCounts.find(windowEvents.front().second);
+        if (--it->second == 0) windowCounts.erase(it);
+        windowEvents.pop_front();
+    }
+}
+
+// ------------------------------------------------------- top --------------------------------------------------------
+std::vector<PopularityTracker::Entry> PopularityTracker::top(char category, size_t k, uint64_t now)
+{
+    std::vector<Entry> out;
+    size_t scope = 0;
+    if (category != 0)
+    {
+        const GenreInfo *genre = MovieFactory::findGenre(category);
+        if (!genre) return out;
+        scope = 1 + static_cast<size_t>(genre - GENRE_TABLE);
+    }
+
+    expire(now);
+    for (const Slot &s : tables[scope].slots)
+    {
+        auto it = windowCounts.find(s.movie);
+        out.push_back(Entry{s.movie, estimate(s.movie), it == windowCounts.end() ? 0 : it->second});
+    }
+
+    std::sort(out.begin(), out.end(), [](const Entry &a, const Entry &b)
+    {
+        if (a.estimate != b.estimate) return a.estimate > b.estimate;
+        if (a.window != b.window) return a.window > b.window;
+        if (a.movie->getCategory() != b.movie->getCategory())
+        {
+            return a.movie->getCategory() < b.movie->getCategory();
+        }
+        return a.movie->buildKey() < b.movie->buildKey();
+    });
+    if (out.size() > k) out.resize(k);
+    return out;
+}
+
+// ---------------------------------------------------- estimate ------------------------------------------------------
+uint64_t PopularityTracker::estimate(const Movie *movie) const
+{
+    uint64_t est = UINT64_MAX;
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row)
+    {
+        est = std::min<uint64_t>(est, sketch[row][bucket(movie, row)]);
+    }
+    return est;
+}
+
+// ---------------------------------------------------- getWindow -----------------------------------------------------
+uint64_t PopularityTracker::getWindow() const
+{
+    return windowCommands;
+}
+
+// ---------------------------------------------------- saveState -----------------------------------------------------
+std::vector<std::string> PopularityTracker::saveState() const
+{
+    std::vector<std::string> lines;
+    for (size_t row = 0; row < SKETCH_DEPTH; ++row)
+    {
+        for (size_t col = 0; col < SKETCH_WIDTH; ++col)
+        {
+            if (sketch[row][col] != 0)
+            {
+                lines.push_back("sketch " + std::to_string(row) + " " + std::to_string(col) + " "
+                                + std::to_string(sketch[row][col]));
+            }
+        }
+    }
+
+    for (size_t scope = 0; scope < tables.size(); ++scope)
+    {
+        if (tables[scope].slots.empty()) continue;
+        std::string line = "table " + std::to_string(scope) + " " + std::to_string(tables[scope].minCount);
+        for (const Slot &s : tables[scope].slots)
+        {
+            line += " " + std::to_string(s.movie->getSlot()) + " " + std::to_string(s.count);
+        }
+        lines.push_back(line);
+    }
+
+    for (const auto &event : windowEvents)
+    {
+        lines.push_back("window " + std::to_string(event.first) + " " + std::to_string(event.second->getSlot()));
+    }
+    return lines;
+}
+
+// --------------------------------------------------- restoreState ---------------------------------------------------
+bool PopularityTracker::restoreState(const std::vector<std::string> &lines, const std::vector<const Movie*> &bySlot)
+{
+    std::memset(sketch, 0, sizeof(sketch));
+    tables.assign(1 + GENRE_COUNT, TopTable());
+    windowEvents.clear();
+    windowCounts.clear();
+
+    auto movieAt = [&bySlot](long long slot) -> const Movie*
+    {
+        return slot >= 0 && static_cast<size_t>(slot) < bySlot.size() ? bySlot[slot] : nullptr;
+    };
+
+    bool ok = true;
+    for (const std::string &line : lines)
+    {
+        std::istringstream ls(line);
+        std::string kind;
+        ls >> kind;
+        if (kind == "sketch")
+        {
+            size_t row = 0, col = 0;
+            uint32_t count = 0;
+            ok = (ls >> row >> col >> count) && row < SKETCH_DEPTH && col < SKETCH_WIDTH;
+            if (ok) sketch[row][col] = count;
+        }
+        else if (kind == "table")
+        {
+            size_t scope = 0;
+            uint64_t minCount = 0;
+            ok = (ls >> scope >> minCount) && scope < tables.size();
+            if (ok) tables[scope].minCount = minCount;
+
+            long long slot = 0;
+            uint64_t count = 0;
+            while (ok && ls >> slot >> count)
+            {
+                const Movie *movie = movieAt(slot);
+                ok = movie && tables[scope].slots.size() < TOP_K;
+                if (ok) tables[scope].slots.push_back(Slot{movie, count});
+            }
+            ok = ok && ls.eof();
+        }
+        else if (kind == "window")
+        {
+            uint64_t seq = 0;
+            long long slot = 0;
+            const Movie *movie = (ls >> seq >> slot) ? movieAt(slot) : nullptr;
+            ok = movie != nullptr;
+            if (ok)
+            {
+                windowEvents.emplace_back(seq, movie);
+                ++windowCounts[movie];
+            }
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            restoreState(std::vector<std::string>(), bySlot);
+            return false;
+        }
+    }
+    return true;
+}
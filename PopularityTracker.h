@@ -0,0 +1,93 @@
+// ----------------------------------------------- PopularityTracker.h ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Streaming "most borrowed" statistics fed by BorrowCommand, in bounded memory:
+//          - a count-min sketch estimating all-time borrows of any title;
+//          - a top-K heavy-hitter table per genre and overall (space-saving style: a title enters a full table by
+//            evicting the current minimum once its sketch estimate exceeds that minimum);
+//          - exact per-title counts over a sliding window of the last W command sequence numbers.
+// Notes  : Titles are identified by Movie::getSlot(). Memory is O(sketch + K per scope + borrows in the window),
+//          independent of catalog size and total borrows. A borrow costs a few hashes and a K-entry scan.
+//          saveState()/restoreState() write and read the whole state as text lines by slot, for checkpoints.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef POPULARITYTRACKER_H
+#define POPULARITYTRACKER_H
+
+#include "movie.h"
+#include <cstddef>         // size_t
+#include <cstdint>         // fixed-width counters
+#include <deque>           // window event queue
+#include <string>          // checkpoint lines
+#include <unordered_map>   // window counts
+#include <utility>         // std::pair
+#include <vector>
+
+class PopularityTracker
+{
+public:
+    static const size_t SKETCH_DEPTH = 4;
+    static const size_t SKETCH_WIDTH = 4096;   // power of two
+    static const size_t TOP_K        = 32;
+
+    struct Entry
+    {
+        const Movie *movie;
+        uint64_t     estimate;   // all-time borrows (count-min upper bound)
+        uint64_t     window;     // exact borrows within the sliding window
+    };
+
+    explicit PopularityTracker(uint64_t windowCommands = 1000);
+
+    // ------------------------------------------------ recordBorrow --------------------------------------------------
+    // Description: Count one borrow of 'movie' issued by command number 'seq' (non-decreasing across calls).
+    void recordBorrow(const Movie *movie, uint64_t seq);
+
+    // --------------------------------------------------- top --------------------------------------------------------
+    // Description: Up to k most-borrowed titles, all genres (category 0) or one genre, as of command 'now'.
+    //              Ordered by estimate, then window count, then category/key.
+    std::vector<Entry> top(char category, size_t k, uint64_t now);
+
+    // ------------------------------------------------- estimate -----------------------------------------------------
+    // Description: Count-min estimate of all-time borrows for 'movie' (never an under-count).
+    uint64_t estimate(const Movie *movie) const;
+
+    uint64_t getWindow() const;
+
+    // ------------------------------------------------- saveState ----------------------------------------------------
+    // Description: The sketch's nonzero cells, the heavy-hitter tables and the window's events as text lines:
+    //              "sketch <row> <column> <count>", "table <scope> <minCount> {<slot> <count>}" and
+    //              "window <seq> <slot>" (oldest first).
+    std::vector<std::string> saveState() const;
+
+    // ------------------------------------------------ restoreState --------------------------------------------------
+    // Description: Replace the state with saveState() lines; bySlot maps a slot to its movie in this catalog.
+    // Returns    : false (state left empty) if a line is malformed or names an unknown slot.
+    bool restoreState(const std::vector<std::string> &lines, const std::vector<const Movie*> &bySlot);
+
+private:
+    struct Slot
+    {
+        const Movie *movie = nullptr;
+        uint64_t     count = 0;
+    };
+
+    struct TopTable
+    {
+        std::vector<Slot> slots;    // up to TOP_K monitored titles
+        uint64_t          minCount = 0;
+    };
+
+    void offer(TopTable &table, const Movie *movie, uint64_t est);
+    void expire(uint64_t now);
+
+    uint32_t                                      sketch[SKETCH_DEPTH][SKETCH_WIDTH];
+    std::vector<TopTable>                         tables;         // [0] = all genres, [1 + GENRE_INDEX[c]] = genre
+    uint64_t                                      windowCommands;
+    std::deque<std::pair<uint64_t, const Movie*>> windowEvents;   // (seq, movie), oldest first
+    std::unordered_map<const Movie*, uint64_t>    windowCounts;
+};
+
+#endif // POPULARITYTRACKER_H
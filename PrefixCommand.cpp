@@ -0,0 +1,24 @@
+// ------------------------------------------------ PrefixCommand.cpp -------------------------------------------------
+// Prints type-ahead matches for a title/director prefix.
+
+#include "PrefixCommand.h"
+#include "Inventory.h"
+#include "Output.h"
+#include <iostream>
+#include <vector>
+
+void PrefixCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    const std::vector<const Movie*> matches = inventory.getPrefixIndex().findPrefix(prefix, limit);
+
+    Output::out() << "Prefix '" << prefix << "':" << std::endl;
+    if (matches.empty())
+    {
+        Output::out() << "  (no matches)" << std::endl;
+        return;
+    }
+    for (const Movie *m : matches)
+    {
+        m->display();
+    }
+}
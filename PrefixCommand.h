@@ -0,0 +1,37 @@
+// ------------------------------------------------- PrefixCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Type-ahead command: lists the first N movies whose title or director starts with a prefix, across all
+//          genres, in lexicographic order of the matching name. Line format: "P <N> <prefix>".
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef PREFIXCOMMAND_H
+#define PREFIXCOMMAND_H
+
+#include "Command.h"
+#include <cstddef>   // size_t
+#include <string>
+
+class PrefixCommand : public Command
+{
+public:
+    PrefixCommand(size_t limit, const std::string &prefix)
+        : limit(limit),
+          prefix(prefix)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "Prefix '<prefix>':" followed by up to N movies with their current stock, or "  (no matches)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    size_t      limit;
+    std::string prefix;
+};
+
+#endif // PREFIXCOMMAND_H
@@ -0,0 +1,170 @@
+// -------------------------------------------------- PrefixIndex.cpp -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Radix-trie insertion and ordered prefix enumeration (see PrefixIndex.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "PrefixIndex.h"
+
+#include <algorithm>      // std::lower_bound
+#include <cctype>         // std::isalnum, std::isspace, std::tolower
+#include <unordered_set>  // movies already emitted by a lookup
+#include <utility>        // std::move
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+// Ordering of movies that share one term: category, then canonical key.
+static bool movieBefore(const Movie *a, const Movie *b)
+{
+    if (a->getCategory() != b->getCategory()) return a->getCategory() < b->getCategory();
+    return a->buildKey() < b->buildKey();
+}
+
+// --------------------------------------------------- PrefixIndex ----------------------------------------------------
+PrefixIndex::PrefixIndex()
+    : nodes(1)
+{
+}
+
+// ---------------------------------------------------- normalize -----------------------------------------------------
+std::string PrefixIndex::normalize(const std::string &text)
+{
+    std::string out;
+    out.reserve(text.size());
+    bool pendingSpace = false;
+    for (unsigned char ch : text)
+    {
+        if (std::isspace(ch))
+        {
+            pendingSpace = true;
+        }
+        else if (std::isalnum(ch))
+        {
+            if (pendingSpace && !out.empty()) out.push_back(' ');
+            pendingSpace = false;
+            out.push_back(static_cast<char>(std::tolower(ch)));
+        }
+    }
+    return out;
+}
+
+// ------------------------------------------------------- add --------------------------------------------------------
+std::vector<std::string> PrefixIndex::termsOf(const Movie *movie)
+{
+    std::vector<std::string> terms;
+    const std::string title    = normalize(std::string(movie->getTitle()));
+    const std::string director = normalize(std::string(movie->getDirector()));
+    if (!title.empty()) terms.push_back(title);
+    if (!director.empty() && director != title) terms.push_back(director);
+    return terms;
+}
+
+void PrefixIndex::add(const Movie *movie, const std::vector<std::string> &terms)
+{
+    for (const std::string &term : terms) insert(term, movie);
+}
+
+// ----------------------------------------------------- insert -------------------------------------------------------
+void PrefixIndex::insert(const std::string &term, const Movie *movie)
+{
+    int cur = 0;
+    size_t pos = 0;
+
+    while (pos < term.size())
+    {
+        // Child whose label starts with the next character (siblings are sorted by that character).
+        auto &kids = nodes[cur].children;
+        auto it = std::lower_bound(kids.begin(), kids.end(), term[pos],
+                                   [this](int n, char c) { return nodes[n].label[0] < c; });
+
+        if (it == kids.end() || nodes[*it].label[0] != term[pos])
+        {
+            Node leaf;
+            leaf.label = term.substr(pos);
+            leaf.movies.push_back(movie);
+            const int idx = static_cast<int>(nodes.size());
+            kids.insert(it, idx);          // 'kids' is not invalidated until nodes grows below
+            nodes.push_back(std::move(leaf));
+            return;
+        }
+
+        const int child = *it;
+        const std::string &label = nodes[child].label;
+        size_t common = 0;
+        while (common < label.size() && pos + common < term.size() && label[common] == term[pos + common])
+        {
+            ++common;
+        }
+
+        if (common < label.size())
+        {
+            // Split the edge: child keeps the tail of its label under a new intermediate node.
+            Node mid;
+            mid.label = label.substr(0, common);
+            mid.children.push_back(child);
+            nodes[child].label = nodes[child].label.substr(common);
+            const int midIdx = static_cast<int>(nodes.size());
+            *it = midIdx;
+            nodes.push_back(std::move(mid));
+            cur = midIdx;
+        }
+        else
+        {
+            cur = child;
+        }
+        pos += common;
+    }
+
+    // Keys are unique, so a movie already filed under this term sits exactly at its sorted position.
+    auto &here = nodes[cur].movies;
+    auto at = std::lower_bound(here.begin(), here.end(), movie, movieBefore);
+    if (at != here.end() && *at == movie) return;
+    here.insert(at, movie);
+}
+
+// ----------------------------------------------------- collect ------------------------------------------------------
+bool PrefixIndex::collect(int node, size_t limit, std::vector<const Movie*> &out,
+                          std::unordered_set<const Movie*> &seen) const
+{
+    for (const Movie *m : nodes[node].movies)
+    {
+        if (!seen.insert(m).second) continue;   // matched earlier via its other term
+        out.push_back(m);
+        if (out.size() >= limit) return true;
+    }
+    for (int child : nodes[node].children)
+    {
+        if (collect(child, limit, out, seen)) return true;
+    }
+    return false;
+}
+
+// --------------------------------------------------- findPrefix -----------------------------------------------------
+std::vector<const Movie*> PrefixIndex::findPrefix(const std::string &prefix, size_t limit) const
+{
+    std::vector<const Movie*> out;
+    const std::string p = normalize(prefix);
+    if (p.empty() || limit == 0) return out;
+
+    int cur = 0;
+    size_t pos = 0;
+    while (pos < p.size())
+    {
+        const auto &kids = nodes[cur].children;
+        auto it = std::lower_bound(kids.begin(), kids.end(), p[pos],
+                                   [this](int n, char c) { return nodes[n].label[0] < c; });
+        if (it == kids.end() || nodes[*it].label[0] != p[pos]) return out;
+
+        const std::string &label = nodes[*it].label;
+        const size_t n = std::min(label.size(), p.size() - pos);
+        if (label.compare(0, n, p, pos, n) != 0) return out;
+
+        cur = *it;
+        pos += n;
+    }
+
+    std::unordered_set<const Movie*> seen;
+    collect(cur, limit, out, seen);
+    return out;
+}
@@ -0,0 +1,61 @@
+// -------------------------------------------------- PrefixIndex.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Type-ahead index over normalized titles and director names of every genre (radix trie).
+// Notes  : - Edges carry string labels and siblings are kept sorted by their first character, so a depth-first
+//            walk yields terms in lexicographic order.
+//          - A lookup descends once per prefix character and then visits only the subtree nodes it emits from;
+//            every node without entries has at least two children, so the walk is O(prefix length + results)
+//            regardless of catalog size. A movie reachable through both its title and its director is emitted
+//            once, deduplicated with a hash set of the results so far.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef PREFIXINDEX_H
+#define PREFIXINDEX_H
+
+#include "movie.h"
+#include <cstddef>    // size_t
+#include <string>
+#include <unordered_set>   // per-lookup dedupe
+#include <vector>
+
+class PrefixIndex
+{
+public:
+    PrefixIndex();
+
+    // ----------------------------------------------------- add ------------------------------------------------------
+    // Description: Index a movie under 'terms', the movie's termsOf(); those can be computed ahead of time, e.g. on
+    //              a reload's parse thread.
+    void add(const Movie *movie, const std::vector<std::string> &terms);
+
+    // Description: A movie's normalized title and normalized director name (empty and repeated terms dropped).
+    static std::vector<std::string> termsOf(const Movie *movie);
+
+    // ------------------------------------------------- findPrefix ---------------------------------------------------
+    // Description: First 'limit' distinct movies whose normalized title or director starts with the normalized
+    //              prefix, in lexicographic order of the matching term (ties: category, then key).
+    std::vector<const Movie*> findPrefix(const std::string &prefix, size_t limit) const;
+
+    // -------------------------------------------------- normalize ---------------------------------------------------
+    // Description: Lower-case letters/digits, drop punctuation, collapse whitespace to single spaces.
+    static std::string normalize(const std::string &text);
+
+private:
+    struct Node
+    {
+        std::string               label;      // edge label from the parent
+        std::vector<int>          children;   // node indices, sorted by first label character
+        std::vector<const Movie*> movies;     // movies whose term ends exactly here
+    };
+
+    void insert(const std::string &term, const Movie *movie);
+    bool collect(int node, size_t limit, std::vector<const Movie*> &out,
+                 std::unordered_set<const Movie*> &seen) const;
+
+    std::vector<Node> nodes;   // nodes[0] is the root
+};
+
+#endif // PREFIXINDEX_H
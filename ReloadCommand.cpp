@@ -0,0 +1,10 @@
+// ------------------------------------------------ ReloadCommand.cpp -------------------------------------------------
+// Starts a background catalog delta parse; Inventory::applyReload merges it the reload lag's commands later.
+
+#include "ReloadCommand.h"
+#include "Inventory.h"
+
+void ReloadCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    inventory.startReload(filename);
+}
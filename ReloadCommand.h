@@ -0,0 +1,36 @@
+// ------------------------------------------------- ReloadCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that hot-reloads a catalog delta file without restarting. Line format: "L <file>".
+//          The file is parsed and staged in the background and merged a fixed number of commands later
+//          (Inventory::getReloadLag, --reload-lag) or at the end of the batch, so replays merge at the same point.
+//          With lag 0 it is merged at the first command after staging finishes instead.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef RELOADCOMMAND_H
+#define RELOADCOMMAND_H
+
+#include "Command.h"
+#include <string>
+
+class ReloadCommand : public Command
+{
+public:
+    explicit ReloadCommand(const std::string &filename)
+        : filename(filename)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Background staging of filename has started; it is merged after any reloads started earlier.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    std::string filename;
+};
+
+#endif // RELOADCOMMAND_H
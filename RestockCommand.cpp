@@ -0,0 +1,69 @@
+// ------------------------------------------------ RestockCommand.cpp ------------------------------------------------
+// Applies one line of stock adjustments as a batch through Inventory::adjustStock.
+
+#include "RestockCommand.h"
+#include "Inventory.h"
+#include "Output.h"
+#include <iostream>
+#include <limits>
+#include <unordered_map>
+
+void RestockCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    // Resolve every item and sum the deltas per title before touching stock, so a bad item leaves the line
+    // unapplied. Titles keep the order of their first item.
+    struct Net
+    {
+        const Movie *movie;
+        const Item  *item;    // first item naming the title
+        long long    delta;
+    };
+    std::vector<Net> net;
+    std::unordered_map<const Movie*, size_t> byMovie;
+    bool ok = true;
+    for (const Item &item : items)
+    {
+        const Movie *movie = inventory.findMovie(item.category, item.key);
+        if (!movie)
+        {
+            Output::err() << "ERROR: Restock: unknown movie " << item.category << " '" << item.key << "'"
+                          << std::endl;
+            ok = false;
+            continue;
+        }
+        auto it = byMovie.emplace(movie, net.size()).first;
+        if (it->second == net.size()) net.push_back(Net{movie, &item, 0});
+        net[it->second].delta += item.delta;
+    }
+
+    for (const Net &entry : net)
+    {
+        const long long stock = entry.movie->getStock() + entry.delta;
+        if (stock >= 0 && stock <= std::numeric_limits<int>::max()) continue;
+
+        Output::err() << "ERROR: Restock: " << entry.item->category << " '" << entry.item->key << "' has "
+                      << entry.movie->getStock() << " on the shelf; cannot apply " << entry.delta << std::endl;
+        ok = false;
+    }
+
+    if (!ok)
+    {
+        Output::err() << "ERROR: Restock: no changes applied (" << items.size() << " items)" << std::endl;
+        return;
+    }
+    for (const Net &entry : net)
+    {
+        if (entry.delta == 0) continue;
+        inventory.adjustStock(entry.item->category, entry.item->key, static_cast<int>(entry.delta));
+    }
+}
+
+CommandRefs RestockCommand::references() const
+{
+    CommandRefs refs;
+    for (const Item &item : items)
+    {
+        refs.titles.push_back({item.category, item.key});
+    }
+    return refs;
+}
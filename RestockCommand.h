@@ -0,0 +1,49 @@
+// ------------------------------------------------- RestockCommand.h -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that restocks (or writes off) shelf copies of many titles at once. Line format:
+//          "U <+/-copies> D <type> <descriptor...> [; <+/-copies> D <type> <descriptor...>]..." (each descriptor as
+//          in a borrow line). Each title's copies change in one Inventory::adjustStock step.
+// Notes  : A line is one batch: if any title is unknown, or any title would end with fewer than zero copies on
+//          the shelf (deltas for the same title are summed first), nothing on the line is applied.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef RESTOCKCOMMAND_H
+#define RESTOCKCOMMAND_H
+
+#include "Command.h"
+#include <string>
+#include <vector>
+
+class RestockCommand : public Command
+{
+public:
+    struct Item
+    {
+        char        category;
+        std::string key;     // canonical movie key
+        int         delta;   // copies to add (negative removes)
+    };
+
+    explicit RestockCommand(std::vector<Item> items)
+        : items(std::move(items))
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Every item was applied to the shelf stock, or (on an unknown title or a shortfall, each reported on
+    //       stderr) none was.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+    // Post: Every title on the line (for read-only validation).
+    CommandRefs references() const override;
+
+private:
+    std::vector<Item> items;
+};
+
+#endif // RESTOCKCOMMAND_H
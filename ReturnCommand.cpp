@@ -10,37 +10,11 @@
 #include "Inventory.h"
 #include "CustomerHashTable.h"
 #include "Customer.h"
+#include "MovieFactory.h"
+#include "Output.h"
 #include <iostream>   // error/status messages
 #include <sstream>    // formatting keys
 
-// ------------------------------------------------ keyForR -----------------------------------------------------------
-// Description: Build canonical inventory key matching Movie::buildKey() semantics.
-// --------------------------------------------------------------------------------------------------------------------
-static std::string keyForR(char type,
-                           const std::string &title,
-                           int year,
-                           const std::string &director,
-                           int month,
-                           const std::string &actor)
-{
-    if (type == 'F')
-    {
-        std::ostringstream oss;
-        oss << title << "|" << year;
-        return oss.str();
-    }
-    if (type == 'D')
-    {
-        return director + "|" + title;
-    }
-    // Classics
-    std::ostringstream oss;
-    oss << year << "-";
-    if (month < 10) oss << "0";
-    oss << month << "|" << actor;
-    return oss.str();
-}
-
 // -------------------------------------------- ReturnCommand (F/D) ---------------------------------------------------
 ReturnCommand::ReturnCommand(int id, char category, const std::string &title,
                              int year, const std::string &director)
@@ -72,29 +46,39 @@ void ReturnCommand::execute(Inventory &inventory, CustomerHashTable &customers)
     Customer *cust = customers.getCustomer(customerID);
     if (!cust)
     {
-        std::cerr << "ERROR: Unknown customer ID " << customerID << std::endl;
+        Output::err() << "ERROR: Unknown customer ID " << customerID << std::endl;
         return;
     }
 
-    const std::string key = keyForR(movieType, title, year, director, month, actor);
+    const std::string key = MovieFactory::keyFor(movieType, title, year, director, month, actor);
 
     // Ensure the customer actually borrowed this title.
-    if (!cust->returnMovie(key))
+    if (!cust->hasBorrowed(key))
     {
-        std::cerr << "ERROR: Return failed: customer " << customerID
-                  << " did not borrow [" << key << "]" << std::endl;
+        Output::err() << "ERROR: Return failed: customer " << customerID
+                      << " did not borrow [" << key << "]" << std::endl;
         return;
     }
 
-    // Return to inventory.
-    if (!inventory.returnMovie(movieType, key, year))
+    // Return to inventory; the customer keeps the title if the inventory has no matching loan.
+    if (!inventory.returnMovie(movieType, key, customerID))
     {
-        std::cerr << "ERROR: Return failed for inventory for key '" << key << "'" << std::endl;
+        Output::err() << "ERROR: Return failed for inventory for key '" << key << "'" << std::endl;
         return;
     }
+    cust->returnMovie(key);
 
     // Record in transaction history.
     std::ostringstream h;
     h << "Return " << movieType << " [" << key << "]";
     cust->addHistory(h.str());
-}
\ No newline at end of file
+}
+
+// ---------------------------------------------------- references ----------------------------------------------------
+CommandRefs ReturnCommand::references() const
+{
+    CommandRefs refs;
+    refs.customerId = customerID;
+    refs.titles.push_back({movieType, MovieFactory::keyFor(movieType, title, year, director, month, actor)});
+    return refs;
+}
@@ -3,11 +3,11 @@
 // Creation Date: <2025-08-21>
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
-// Purpose : Command that returns a movie for a given customer. Supports Comedy (F), Drama (D), Classics (C).
+// Purpose : Command that returns a movie for a given customer. Supports every genre in MovieFactory's table.
 // Notes   : Uses the same canonical keys as Inventory/Movie::buildKey():
-//           - F: "Title|Year"
-//           - D: "Director|Title"
-//           - C: "YYYY-MM|First Last"
+//           - F/N: "Title|Year"
+//           - D/W: "Director|Title"
+//           - C  : "YYYY-MM|First Last"
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef RETURNCOMMAND_H
@@ -23,7 +23,7 @@ class ReturnCommand : public Command
 {
 public:
     // ------------------------------------------ ReturnCommand (F/D) -------------------------------------------------
-    // Description: Construct a return for Comedy/Drama.
+    // Description: Construct a return for Comedy/Drama/Documentary/Foreign.
     ReturnCommand(int id, char category, const std::string &title,
                   int year, const std::string &director);
 
@@ -36,11 +36,15 @@ public:
     // Post: If the customer had borrowed this movie, it is returned to inventory and logged in history.
     void execute(Inventory &inventory, CustomerHashTable &customers) const override;
 
+    // ----------------------------------------------- references -----------------------------------------------------
+    // Post: The customer id and the canonical key of the title to return.
+    CommandRefs references() const override;
+
 private:
     int         customerID;
-    char        movieType;     // 'F','D','C'
+    char        movieType;     // 'F','D','C','N','W'
 
-    // F/D fields
+    // F/D/N/W fields
     std::string title;
     int         year;
     std::string director;
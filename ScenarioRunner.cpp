@@ -0,0 +1,266 @@
+// ------------------------------------------------ ScenarioRunner.cpp ------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Scenario list loading, baseline load, and the fork/replay/reap loop (see ScenarioRunner.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "ScenarioRunner.h"
+#include "CommandProcessor.h"
+#include "Output.h"
+#include "LineScanner.h"
+
+#include <cerrno>         // EINTR
+#include <cstdio>         // std::snprintf, std::sscanf
+#include <fstream>        // scenario list / per-scenario outputs
+#include <iomanip>        // timing precision
+#include <iostream>       // std::cout / std::cerr flush before fork
+#include <set>            // duplicate names
+#include <sstream>        // list parsing
+#include <thread>         // hardware concurrency
+#include <sys/wait.h>     // waitpid
+#include <unistd.h>       // fork, pipe, _exit
+
+using Clock = std::chrono::steady_clock;
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline std::string trim(const std::string &s)
+{
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+static double msSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// --------------------------------------------------- loadList -------------------------------------------------------
+bool ScenarioRunner::loadList(const std::string &filename)
+{
+    std::ifstream fin(filename);
+    if (!fin)
+    {
+        Output::err() << "ERROR: cannot open scenario list: " << filename << std::endl;
+        return false;
+    }
+
+    std::set<std::string> names;
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fin, line))
+    {
+        ++lineno;
+        std::string raw = trim(line);
+        if (raw.empty() || raw[0] == '#') continue;
+
+        std::istringstream ss(raw);
+        Scenario scenario;
+        if (!(ss >> scenario.config.name >> scenario.config.commandsFile))
+        {
+            Output::err() << "ERROR: [scenarios " << lineno << "] expected '<name> <commandsFile>' -> "
+                          << raw << std::endl;
+            continue;
+        }
+        if (scenario.config.name.find('/') != std::string::npos || scenario.config.name == "."
+            || scenario.config.name == "..")
+        {
+            Output::err() << "ERROR: [scenarios " << lineno << "] scenario name must not be a path -> "
+                          << raw << std::endl;
+            continue;
+        }
+        if (!names.insert(scenario.config.name).second)
+        {
+            Output::err() << "ERROR: [scenarios " << lineno << "] duplicate scenario '" << scenario.config.name
+                          << "' -> " << raw << std::endl;
+            continue;
+        }
+        scenarios.push_back(scenario);
+    }
+
+    if (scenarios.empty())
+    {
+        Output::err() << "ERROR: scenario list names no scenarios: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------- loadBaseline -----------------------------------------------------
+bool ScenarioRunner::loadBaseline(const std::string &moviesFile, const std::string &customersFile)
+{
+    // Sequential on purpose: fork() copies only the calling thread, so no loader thread may be alive (or have left
+    // a lock held) when the children are started.
+    Clock::time_point start = Clock::now();
+    inventory.loadMovies(moviesFile);
+    moviesMs = msSince(start);
+
+    start = Clock::now();
+    const bool ok = customers.loadCustomers(customersFile);
+    customersMs = msSince(start);
+    if (!ok) return false;
+
+    Output::err() << std::fixed << std::setprecision(2)
+                  << "[info] Baseline: movies " << moviesMs << " ms | customers " << customersMs
+                  << " ms | loaded once for " << scenarios.size() << " scenarios" << std::endl;
+    return true;
+}
+
+// ------------------------------------------------------ run ---------------------------------------------------------
+bool ScenarioRunner::run(const std::string &outDir, unsigned jobs)
+{
+    if (jobs == 0) jobs = std::thread::hardware_concurrency();
+    if (jobs == 0) jobs = 1;
+
+    size_t next    = 0;
+    size_t running = 0;
+    while (next < scenarios.size() || running > 0)
+    {
+        while (running < jobs && next < scenarios.size())
+        {
+            if (start(scenarios[next], outDir)) ++running;
+            ++next;
+        }
+        if (running == 0) continue;
+
+        int status = 0;
+        const pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0)
+        {
+            if (errno == EINTR) continue;
+            Output::err() << "ERROR: waitpid failed while scenarios were running" << std::endl;
+            break;
+        }
+        for (Scenario &scenario : scenarios)
+        {
+            if (scenario.pid != pid) continue;
+            finish(scenario, status);
+            --running;
+            break;
+        }
+    }
+
+    bool allRan = true;
+    for (const Scenario &scenario : scenarios)
+    {
+        Output::err() << "[info] Scenario " << scenario.config.name;
+        if (!scenario.ran)
+        {
+            Output::err() << " failed (see scenario_" << scenario.config.name << ".err)" << std::endl;
+            allRan = false;
+            continue;
+        }
+        Output::err() << " | Commands executed: " << scenario.executed
+                      << " | skipped/malformed: "  << scenario.skipped
+                      << " | copies " << (scenario.balanced ? "balanced" : "UNBALANCED")
+                      << " | " << std::fixed << std::setprecision(2) << scenario.elapsedMs << " ms" << std::endl;
+    }
+    return allRan;
+}
+
+// ----------------------------------------------------- start --------------------------------------------------------
+bool ScenarioRunner::start(Scenario &scenario, const std::string &outDir)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        Output::err() << "ERROR: cannot create report pipe for scenario " << scenario.config.name << std::endl;
+        return false;
+    }
+
+    // Anything still buffered would otherwise be written once by the parent and again by the child.
+    std::cout.flush();
+    std::cerr.flush();
+    Output::out().flush();
+    Output::err().flush();
+
+    scenario.started = Clock::now();
+    const pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        Output::err() << "ERROR: cannot fork scenario " << scenario.config.name << std::endl;
+        return false;
+    }
+    if (pid == 0)
+    {
+        close(fds[0]);
+        for (Scenario &other : scenarios)   // read ends of the scenarios still running belong to the parent
+        {
+            if (other.report >= 0) close(other.report);
+        }
+        const int code = replay(scenario, outDir, fds[1]);
+        std::cout.flush();
+        std::cerr.flush();
+        _exit(code);
+    }
+
+    close(fds[1]);
+    scenario.pid    = pid;
+    scenario.report = fds[0];
+    return true;
+}
+
+// ----------------------------------------------------- replay -------------------------------------------------------
+// Runs in the child: every change lands in its private copy-on-write pages of the baseline.
+int ScenarioRunner::replay(const Scenario &scenario, const std::string &outDir, int reportFd)
+{
+    const std::string base = outDir + "/scenario_" + scenario.config.name;
+    std::ofstream out(base + ".out");
+    std::ofstream err(base + ".err");
+    std::ofstream completed(base + ".completed");
+
+    // Fall back to the shared streams only for the file we could not open; errors there are rare.
+    Output::Redirect redirect(out ? static_cast<std::ostream&>(out) : Output::out(),
+                              err ? static_cast<std::ostream&>(err) : Output::err());
+    if (!completed)
+    {
+        Output::err() << "ERROR: cannot open completed log file for write: " << base << ".completed" << std::endl;
+        return 1;
+    }
+    completed << "# Completed (parsed & executed) commands\n";
+
+    LineReader reader;
+    if (!reader.open(scenario.config.commandsFile))
+    {
+        Output::err() << "ERROR: cannot open commands file: " << scenario.config.commandsFile << std::endl;
+        return 1;
+    }
+
+    CommandProcessor processor(inventory, customers, completed);
+    std::string_view line;
+    int lineNo = 0;
+    while (reader.next(line))
+    {
+        processor.processLine(std::string(line), ++lineNo);
+    }
+    inventory.applyReload(true);
+
+    char buf[64];
+    const int len = std::snprintf(buf, sizeof(buf), "%d %d %d\n", processor.getExecuted(), processor.getSkipped(),
+                                  inventory.checkInvariant() ? 1 : 0);
+    if (write(reportFd, buf, static_cast<size_t>(len)) != len) return 1;
+    close(reportFd);
+    return 0;
+}
+
+// ----------------------------------------------------- finish -------------------------------------------------------
+void ScenarioRunner::finish(Scenario &scenario, int status)
+{
+    scenario.elapsedMs = msSince(scenario.started);
+
+    // The report is a few bytes (well under PIPE_BUF), written in one call before the child exited.
+    char buf[64] = {};
+    const ssize_t got = read(scenario.report, buf, sizeof(buf) - 1);
+    close(scenario.report);
+    scenario.report = -1;
+
+    int balanced = 0;
+    scenario.ran = WIFEXITED(status) && WEXITSTATUS(status) == 0 && got > 0
+                && std::sscanf(buf, "%d %d %d", &scenario.executed, &scenario.skipped, &balanced) == 3;
+    scenario.balanced = balanced != 0;
+}
@@ -0,0 +1,78 @@
+// ------------------------------------------------- ScenarioRunner.h -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: What-if mode. Loads one baseline Inventory + CustomerHashTable, then forks one child process per
+//          scenario; each child replays its own commands file against the baseline it inherited.
+// Notes  : - Scenario list lines are "<name> <commandsFile>" (blank lines and '#' comments ignored). Names become
+//            file names: output goes to <outDir>/scenario_<name>.out, .err and .completed.
+//          - fork() shares the baseline's pages copy-on-write, so a child only pays for the pages its commands
+//            touch, and setup (parsing, indexing, filters) is paid once for all scenarios.
+//          - At most 'jobs' children run at once. The baseline is loaded on the parent's only thread, so the
+//            children never inherit a lock held by another thread. A child reports its counts over a pipe and
+//            leaves with _exit(), skipping the teardown of its copy of the baseline.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef SCENARIORUNNER_H
+#define SCENARIORUNNER_H
+
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+
+#include <chrono>   // per-scenario wall time
+#include <string>
+#include <vector>
+
+struct ScenarioConfig
+{
+    std::string name;
+    std::string commandsFile;
+};
+
+class ScenarioRunner
+{
+public:
+    // -------------------------------------------------- loadList ----------------------------------------------------
+    // Description: Read the scenario list; duplicate, malformed or unsafe (path-like) names are reported and
+    //              skipped.
+    // Returns    : false if the file cannot be opened or lists no scenarios.
+    bool loadList(const std::string &filename);
+
+    // ------------------------------------------------ loadBaseline --------------------------------------------------
+    // Description: Load the shared starting state.
+    // Returns    : false if the customers file cannot be opened (already reported).
+    bool loadBaseline(const std::string &moviesFile, const std::string &customersFile);
+
+    // ---------------------------------------------------- run -------------------------------------------------------
+    // Description: Fork and replay every scenario, up to 'jobs' at a time (0 = hardware concurrency), then print a
+    //              per-scenario summary in list order.
+    // Returns    : true if every scenario ran to completion.
+    bool run(const std::string &outDir, unsigned jobs);
+
+private:
+    struct Scenario
+    {
+        ScenarioConfig config;
+        int            pid       = -1;
+        int            report    = -1;     // read end of the child's report pipe
+        std::chrono::steady_clock::time_point started;
+        double         elapsedMs = 0.0;
+        bool           ran       = false;
+        int            executed  = 0;
+        int            skipped   = 0;
+        bool           balanced  = true;   // shelf + checked out == total after the batch
+    };
+
+    bool start(Scenario &scenario, const std::string &outDir);
+    int  replay(const Scenario &scenario, const std::string &outDir, int reportFd);   // in the child
+    void finish(Scenario &scenario, int status);
+
+    Inventory              inventory;
+    CustomerHashTable      customers;
+    std::vector<Scenario>  scenarios;
+    double                 moviesMs    = 0.0;
+    double                 customersMs = 0.0;
+};
+
+#endif // SCENARIORUNNER_H
@@ -0,0 +1,24 @@
+// ------------------------------------------------ SearchCommand.cpp -------------------------------------------------
+// Prints the closest catalog matches for free text.
+
+#include "SearchCommand.h"
+#include "Inventory.h"
+#include "Output.h"
+#include <iostream>
+#include <vector>
+
+void SearchCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    const std::vector<TrigramIndex::Match> matches = inventory.getTextIndex().search(text, 10, 0.2);
+
+    Output::out() << "Search '" << text << "':" << std::endl;
+    if (matches.empty())
+    {
+        Output::out() << "  (no matches)" << std::endl;
+        return;
+    }
+    for (const auto &m : matches)
+    {
+        m.movie->display();
+    }
+}
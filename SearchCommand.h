@@ -0,0 +1,34 @@
+// ------------------------------------------------- SearchCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that prints the movies whose title, director or major actor best match free text.
+//          Line format: "S <text>". Uses the inventory's trigram index, so misspellings still match.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef SEARCHCOMMAND_H
+#define SEARCHCOMMAND_H
+
+#include "Command.h"
+#include <string>
+
+class SearchCommand : public Command
+{
+public:
+    explicit SearchCommand(const std::string &text)
+        : text(text)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "Search '<text>':" followed by up to ten matching movies (best first), or "  (no matches)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    std::string text;
+};
+
+#endif // SEARCHCOMMAND_H
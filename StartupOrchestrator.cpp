@@ -0,0 +1,175 @@
+// --------------------------------------------- StartupOrchestrator.cpp ----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Parallel movie/customer load and command prefetch (see StartupOrchestrator.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "StartupOrchestrator.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "CommandProcessor.h"
+#include "CommandFactory.h"
+#include "Output.h"
+
+#include <chrono>     // task timings
+#include <future>     // std::async
+#include <iostream>   // std::endl
+#include <sstream>    // per-task diagnostics buffers
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+using Clock = std::chrono::steady_clock;
+
+static inline double msSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static inline bool isBlank(const std::string &s)
+{
+    return s.find_first_not_of(" \t\r\n") == std::string::npos;
+}
+
+// ----------------------------------------------- StartupOrchestrator ------------------------------------------------
+StartupOrchestrator::StartupOrchestrator(Inventory &inventory, CustomerHashTable &customers)
+    : inventory(inventory),
+      customers(customers),
+      lineNo(0),
+      moviesMs(0),
+      customersMs(0),
+      commandsMs(0),
+      startupMs(0)
+{
+}
+
+StartupOrchestrator::~StartupOrchestrator()
+{
+    for (PreparedLine &p : prepared) delete p.cmd;
+}
+
+// ------------------------------------------------------ load --------------------------------------------------------
+bool StartupOrchestrator::load(const std::string &moviesFile, const std::string &customersFile,
+                               const std::string &commandsFile, const Checkpoint::State *resume)
+{
+    const Clock::time_point start = Clock::now();
+    std::ostringstream moviesLog, customersLog, commandsLog;
+
+    auto movies = std::async(std::launch::async, [&]()
+    {
+        Output::Redirect to(moviesLog, moviesLog);
+        if (resume)
+        {
+            std::istringstream catalog(resume->catalog);
+            inventory.loadMovies(catalog);
+        }
+        else
+        {
+            inventory.loadMovies(moviesFile);
+        }
+        moviesMs = msSince(start);
+    });
+
+    auto people = std::async(std::launch::async, [&]()
+    {
+        Output::Redirect to(customersLog, customersLog);
+        const bool ok = customers.loadCustomers(customersFile);
+        customersMs = msSince(start);
+        return ok;
+    });
+
+    auto prefetch = std::async(std::launch::async, [&]()
+    {
+        Output::Redirect to(commandsLog, commandsLog);
+        if (!commands.open(commandsFile))
+        {
+            Output::err() << "ERROR: cannot open commands file: " << commandsFile << std::endl;
+            commandsMs = msSince(start);
+            return false;
+        }
+        if (resume)
+        {
+            commands.seek(resume->offset);
+            lineNo = resume->lineNo;
+        }
+
+        std::string_view view;
+        while (prepared.size() < PREFETCH_LINES && commands.next(view))
+        {
+            ++lineNo;
+            const std::string line(view);
+            if (isBlank(line)) continue;
+
+            std::ostringstream parseLog;
+            PreparedLine p{lineNo, commands.offset(), line, nullptr, ""};
+            {
+                Output::Redirect perLine(parseLog, parseLog);
+                p.cmd = CommandFactory::createCommand(line);
+            }
+            p.parseErrors = parseLog.str();
+            prepared.push_back(std::move(p));
+        }
+        commandsMs = msSince(start);
+        return true;
+    });
+
+    // Join in file order. A task that threw rethrows from get(); the other futures still join on destruction.
+    movies.get();
+    const bool customersOk = people.get();
+    const bool commandsOk  = prefetch.get();
+    startupMs = msSince(start);
+
+    Output::err() << moviesLog.str() << customersLog.str();
+    if (!customersOk) return false;
+    Output::err() << commandsLog.str();
+    if (resume) Checkpoint::restoreLoans(*resume, inventory, customers);
+    return commandsOk;
+}
+
+// ----------------------------------------------------- replay -------------------------------------------------------
+void StartupOrchestrator::replay(CommandProcessor &processor, const LineHook &afterLine)
+{
+    for (PreparedLine &p : prepared)
+    {
+        Output::err() << p.parseErrors;
+        Command *cmd = p.cmd;
+        p.cmd = nullptr;
+        processor.processParsed(p.line, p.lineNo, cmd);
+        if (afterLine) afterLine(p.endOffset, p.lineNo);
+    }
+    prepared.clear();
+
+    std::string_view view;
+    while (commands.next(view))
+    {
+        const std::string line(view);
+        processor.processLine(line, ++lineNo);
+        if (afterLine && !isBlank(line)) afterLine(commands.offset(), lineNo);
+    }
+}
+
+// ----------------------------------------------------- timings ------------------------------------------------------
+double StartupOrchestrator::getMoviesMs() const
+{
+    return moviesMs;
+}
+
+double StartupOrchestrator::getCustomersMs() const
+{
+    return customersMs;
+}
+
+double StartupOrchestrator::getCommandsMs() const
+{
+    return commandsMs;
+}
+
+double StartupOrchestrator::getStartupMs() const
+{
+    return startupMs;
+}
+
+size_t StartupOrchestrator::getPrefetched() const
+{
+    return prepared.size();
+}
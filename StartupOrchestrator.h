@@ -0,0 +1,87 @@
+// ---------------------------------------------- StartupOrchestrator.h -----------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Single-store startup in parallel. The movie load, the customer load and the prefetch/parse of the
+//          first PREFETCH_LINES command lines run on separate threads; the batch starts once all three finish.
+// Notes  : - With a checkpoint (see Checkpoint.h) the movie task rebuilds the catalog from it instead of the
+//            movies file, the prefetch task seeks straight to the saved byte offset, and loans/histories are
+//            re-applied once both loads are done.
+//          - Each task prints into its own buffer (Output::Redirect). Buffers are flushed afterwards in file
+//            order (movies, customers, commands), so diagnostics read exactly as a sequential startup's would.
+//          - Parse errors of prefetched commands are held per line and printed when that line's turn comes to
+//            execute, keeping them interleaved with execution output as before.
+//          - Lines past the prefetch window are read and parsed on demand, so memory stays bounded.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef STARTUPORCHESTRATOR_H
+#define STARTUPORCHESTRATOR_H
+
+#include "Checkpoint.h"   // resume state
+#include "LineScanner.h"  // chunked command-line reader
+
+#include <cstddef>    // size_t
+#include <functional> // per-line progress hook
+#include <string>
+#include <vector>
+
+class Inventory;          // fwd decl
+class CustomerHashTable;  // fwd decl
+class CommandProcessor;   // fwd decl
+class Command;            // fwd decl
+
+class StartupOrchestrator
+{
+public:
+    static const size_t PREFETCH_LINES = 65536;
+
+    StartupOrchestrator(Inventory &inventory, CustomerHashTable &customers);
+    ~StartupOrchestrator();
+
+    StartupOrchestrator(const StartupOrchestrator&) = delete;
+    StartupOrchestrator& operator=(const StartupOrchestrator&) = delete;
+
+    // ---------------------------------------------------- load ------------------------------------------------------
+    // Description: Run the three startup tasks concurrently, then print their diagnostics in file order.
+    // Returns    : false if the customers or commands file cannot be opened (already reported).
+    //              resume (optional) is a checkpoint to continue from.
+    bool load(const std::string &moviesFile, const std::string &customersFile, const std::string &commandsFile,
+              const Checkpoint::State *resume = nullptr);
+
+    // ---------------------------------------------------- replay ----------------------------------------------------
+    // Description: Execute the prefetched commands, then the rest of the commands file, through processor.
+    //              afterLine (optional) is called after each non-blank line with the byte offset just past that
+    //              line and its line number - the position a checkpoint taken at that moment resumes from.
+    using LineHook = std::function<void(std::streamoff offset, int lineNo)>;
+    void replay(CommandProcessor &processor, const LineHook &afterLine = nullptr);
+
+    // ------------------------------------------------- timings (ms) -------------------------------------------------
+    double getMoviesMs()    const;
+    double getCustomersMs() const;
+    double getCommandsMs()  const;   // prefetch + parse
+    double getStartupMs()   const;   // load() start until the first command can execute
+    size_t getPrefetched()  const;
+
+private:
+    struct PreparedLine
+    {
+        int            lineNo;
+        std::streamoff endOffset;     // commands file position just past this line
+        std::string    line;
+        Command       *cmd;           // owned until replayed; nullptr = parse failed
+        std::string    parseErrors;   // diagnostics printed while parsing
+    };
+
+    Inventory                 &inventory;
+    CustomerHashTable         &customers;
+    LineReader                 commands;
+    int                        lineNo;
+    std::vector<PreparedLine>  prepared;
+    double                     moviesMs;
+    double                     customersMs;
+    double                     commandsMs;
+    double                     startupMs;
+};
+
+#endif // STARTUPORCHESTRATOR_H
@@ -0,0 +1,45 @@
+// ------------------------------------------------- StatsCommand.cpp -------------------------------------------------
+// Prints Bloom-filter sizing and probe counters for customer ids and per-genre movie keys, then the hot-title cache.
+
+#include "StatsCommand.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "MovieFactory.h"
+#include "Output.h"
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// -------------------------------------------------- printFilter -----------------------------------------------------
+static void printFilter(const std::string &name, const BloomFilter &filter)
+{
+    const BloomFilter::Stats s = filter.getStats();
+    Output::out() << "  " << std::left << std::setw(18) << name << std::right << s.items << " items / "
+                  << s.capacity << " cap | " << s.bits << " bits, k=" << s.hashes << ", target fpr "
+                  << std::fixed << std::setprecision(2) << s.rate * 100.0 << "%" << std::defaultfloat
+                  << " | probes " << s.probes << " | rejected " << s.rejected << " | passed " << s.passed
+                  << " | false positives " << s.falsePositives << std::endl;
+}
+
+// --------------------------------------------------- printCache -----------------------------------------------------
+static void printCache(const TitleCache &cache)
+{
+    const TitleCache::Stats s = cache.getStats();
+    const uint64_t lookups = s.hits + s.misses;
+    Output::out() << "  " << std::left << std::setw(18) << "title cache" << std::right << s.used << " / " << s.slots
+                  << " slots | lookups " << lookups << " | hits " << s.hits << " | misses " << s.misses
+                  << " | hit rate " << std::fixed << std::setprecision(2)
+                  << (lookups ? 100.0 * static_cast<double>(s.hits) / static_cast<double>(lookups) : 0.0) << "%"
+                  << std::defaultfloat << " | replaced " << s.replaced << " | declined " << s.declined << std::endl;
+}
+
+void StatsCommand::execute(Inventory &inventory, CustomerHashTable &customers) const
+{
+    Output::out() << "=== Lookup stats ===" << std::endl;
+    printFilter("customer ids", customers.getIdFilter());
+    for (const GenreInfo &genre : GENRE_TABLE)
+    {
+        printFilter(std::string("keys ") + genre.label, *inventory.getKeyFilter(genre.code));
+    }
+    printCache(inventory.getTitleCache());
+}
@@ -0,0 +1,30 @@
+// -------------------------------------------------- StatsCommand.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command ("V") that prints lookup-path statistics: for the customer-id filter and each genre's key
+//          filter, its size, hash count and target false-positive rate, and how many probes it rejected, passed,
+//          and passed falsely; then the hot-title cache's occupancy, hits, misses and hit rate.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef STATSCOMMAND_H
+#define STATSCOMMAND_H
+
+#include "Command.h"
+
+class StatsCommand : public Command
+{
+public:
+    StatsCommand() = default;
+    ~StatsCommand() override = default;
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints "=== Lookup stats ===", one line per filter (customer ids, then genres in table order) and one
+    //       line for the title cache.
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+};
+
+#endif // STATSCOMMAND_H
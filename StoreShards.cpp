@@ -0,0 +1,218 @@
+// ------------------------------------------------- StoreShards.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Manifest loading, command routing by store prefix, and the per-store worker pool (see StoreShards.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "StoreShards.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "CommandProcessor.h"
+#include "Output.h"
+#include "LineScanner.h"
+#include "StringPool.h"
+
+#include <atomic>     // work-claiming counter
+#include <cctype>     // std::isdigit
+#include <fstream>    // manifest / commands / per-store outputs
+#include <sstream>    // manifest parsing
+#include <thread>     // worker pool
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static inline std::string trim(const std::string &s)
+{
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+// ------------------------------------------------- loadManifest -----------------------------------------------------
+bool StoreShards::loadManifest(const std::string &filename)
+{
+    std::ifstream fin(filename);
+    if (!fin)
+    {
+        Output::err() << "ERROR: cannot open store manifest: " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fin, line))
+    {
+        ++lineno;
+        std::string raw = trim(line);
+        if (raw.empty() || raw[0] == '#') continue;
+
+        std::istringstream ss(raw);
+        StoreConfig cfg;
+        if (!(ss >> cfg.storeId >> cfg.moviesFile >> cfg.customersFile))
+        {
+            Output::err() << "ERROR: [manifest " << lineno << "] expected '<storeId> <movies> <customers>' -> "
+                          << raw << std::endl;
+            continue;
+        }
+        if (indexById.count(cfg.storeId))
+        {
+            Output::err() << "ERROR: [manifest " << lineno << "] duplicate store " << cfg.storeId << std::endl;
+            continue;
+        }
+
+        indexById[cfg.storeId] = shards.size();
+        Shard shard;
+        shard.config = cfg;
+        shards.push_back(std::move(shard));
+    }
+
+    if (shards.empty())
+    {
+        Output::err() << "ERROR: store manifest lists no stores: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------- splitStorePrefix ---------------------------------------------------
+bool StoreShards::splitStorePrefix(const std::string &line, int &storeId, std::string &command)
+{
+    size_t b = line.find_first_not_of(" \t");
+    if (b == std::string::npos || line[b] != '@') return false;
+
+    size_t p = b + 1;
+    int id = 0;
+    size_t digits = 0;
+    while (p < line.size() && std::isdigit(static_cast<unsigned char>(line[p])) && digits < 9)
+    {
+        id = id * 10 + (line[p] - '0');
+        ++p;
+        ++digits;
+    }
+    if (digits == 0 || (p < line.size() && line[p] != ' ' && line[p] != '\t')) return false;
+
+    storeId = id;
+    command = (p < line.size()) ? line.substr(p + 1) : std::string();
+    return true;
+}
+
+// ----------------------------------------------- partitionCommands --------------------------------------------------
+bool StoreShards::partitionCommands(const std::string &filename)
+{
+    LineReader reader;
+    if (!reader.open(filename))
+    {
+        Output::err() << "ERROR: cannot open commands file: " << filename << std::endl;
+        return false;
+    }
+
+    std::string_view view;
+    int lineNo = 0;
+    while (reader.next(view))
+    {
+        ++lineNo;
+        if (LineScanner::trim(view).empty()) continue;
+        const std::string line(view);
+
+        int storeId = 0;
+        std::string command;
+        if (!splitStorePrefix(line, storeId, command))
+        {
+            shards.front().lines.emplace_back(lineNo, line);
+            continue;
+        }
+
+        auto it = indexById.find(storeId);
+        if (it == indexById.end())
+        {
+            Output::err() << "ERROR: [command line " << lineNo << "] unknown store " << storeId
+                          << " -> " << line << std::endl;
+            continue;
+        }
+        shards[it->second].lines.emplace_back(lineNo, command);
+    }
+    return true;
+}
+
+// --------------------------------------------------- runShard -------------------------------------------------------
+void StoreShards::runShard(Shard &shard, const std::string &outDir)
+{
+    const std::string base = outDir + "/store_" + std::to_string(shard.config.storeId);
+    std::ofstream out(base + ".out");
+    std::ofstream err(base + ".err");
+    std::ofstream completed(base + ".completed");
+
+    // Fall back to the shared streams only for the file we could not open; errors there are rare.
+    Output::Redirect redirect(out ? static_cast<std::ostream&>(out) : Output::out(),
+                              err ? static_cast<std::ostream&>(err) : Output::err());
+    if (!completed)
+    {
+        Output::err() << "ERROR: cannot open completed log file for write: " << base << ".completed" << std::endl;
+        return;
+    }
+    completed << "# Completed (parsed & executed) commands\n";
+
+    // The whole shard interns into its own inventory's pool, never the process-wide fallback, so stores running
+    // on other workers never wait on each other's locks.
+    Inventory inventory;
+    StringPool::Use interning(inventory.getStringPool());
+    inventory.loadMovies(shard.config.moviesFile);
+
+    CustomerHashTable customers;
+    if (!customers.loadCustomers(shard.config.customersFile)) return;
+    shard.loaded = true;
+
+    CommandProcessor processor(inventory, customers, completed);
+    for (const auto &entry : shard.lines)
+    {
+        processor.processLine(entry.second, entry.first);
+    }
+    inventory.applyReload(true);
+
+    shard.executed = processor.getExecuted();
+    shard.skipped  = processor.getSkipped();
+    shard.balanced = inventory.checkInvariant();
+}
+
+// ------------------------------------------------------ run ---------------------------------------------------------
+void StoreShards::run(const std::string &outDir, unsigned threads)
+{
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    if (threads > shards.size()) threads = static_cast<unsigned>(shards.size());
+
+    // Workers claim whole stores; a store's commands therefore run in file order on a single thread.
+    std::atomic<size_t> next(0);
+    auto worker = [&]()
+    {
+        for (size_t i = next.fetch_add(1); i < shards.size(); i = next.fetch_add(1))
+        {
+            runShard(shards[i], outDir);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t)
+    {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+
+    for (const auto &shard : shards)
+    {
+        Output::err() << "[info] Store " << shard.config.storeId;
+        if (!shard.loaded)
+        {
+            Output::err() << " failed to load (see store_" << shard.config.storeId << ".err)" << std::endl;
+            continue;
+        }
+        Output::err() << " | Commands executed: " << shard.executed
+                      << " | skipped/malformed: "  << shard.skipped
+                      << " | copies " << (shard.balanced ? "balanced" : "UNBALANCED") << std::endl;
+    }
+}
@@ -0,0 +1,73 @@
+// -------------------------------------------------- StoreShards.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Multi-store mode. Hosts one independent Inventory + CustomerHashTable pair per store ID in a single
+//          process and replays each store's commands on a pool of worker threads.
+// Notes  : - Manifest lines are "<storeId> <moviesFile> <customersFile>" (blank lines and '#' comments ignored).
+//          - Command lines may carry an optional "@<storeId> " prefix; unprefixed lines go to the first store
+//            listed in the manifest.
+//          - Each shard is owned by exactly one worker at a time and interns its catalog text in its own
+//            inventory's StringPool (bound for the whole run), so stores never share locks. Per-store output goes
+//            to <outDir>/store_<id>.out, .err and .completed.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef STORESHARDS_H
+#define STORESHARDS_H
+
+#include <cstddef>         // size_t
+#include <string>
+#include <unordered_map>   // store id -> shard index
+#include <utility>         // std::pair
+#include <vector>
+
+struct StoreConfig
+{
+    int         storeId;
+    std::string moviesFile;
+    std::string customersFile;
+};
+
+class StoreShards
+{
+public:
+    // ------------------------------------------------ loadManifest --------------------------------------------------
+    // Description: Read the store manifest; duplicate or malformed entries are reported and skipped.
+    // Returns    : false if the file cannot be opened or lists no stores.
+    bool loadManifest(const std::string &filename);
+
+    // --------------------------------------------- partitionCommands ------------------------------------------------
+    // Description: Route every command line to its store's queue, keeping original line numbers. Lines for
+    //              unknown stores are reported and dropped.
+    // Returns    : false if the commands file cannot be opened.
+    bool partitionCommands(const std::string &filename);
+
+    // ---------------------------------------------------- run -------------------------------------------------------
+    // Description: Load and replay every store on up to 'threads' workers (0 = hardware concurrency), then print a
+    //              per-store summary in manifest order.
+    void run(const std::string &outDir, unsigned threads);
+
+    // ---------------------------------------------- splitStorePrefix ------------------------------------------------
+    // Description: If line starts with "@<id>", store the id and the remaining command text.
+    // Returns    : true when a well-formed prefix was found.
+    static bool splitStorePrefix(const std::string &line, int &storeId, std::string &command);
+
+private:
+    struct Shard
+    {
+        StoreConfig                              config;
+        std::vector<std::pair<int, std::string>> lines;     // (original line number, command text)
+        int                                      executed = 0;
+        int                                      skipped  = 0;
+        bool                                     loaded   = false;
+        bool                                     balanced = true;   // shelf + checked out == total after the batch
+    };
+
+    void runShard(Shard &shard, const std::string &outDir);
+
+    std::vector<Shard>              shards;
+    std::unordered_map<int, size_t> indexById;
+};
+
+#endif // STORESHARDS_H
@@ -0,0 +1,129 @@
+// -------------------------------------------------- StringPool.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Per-owner arena interner with a thread-bound current pool (see StringPool.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "StringPool.h"
+
+#include <algorithm>   // std::min, std::max
+#include <cstring>     // std::memcpy
+#include <functional>  // std::hash<std::string_view>
+
+// The empty string is shared by every default-constructed field and never touches a pool.
+static const char EMPTY[] = "";
+
+// ---------------------------------------------------- ~StringPool ---------------------------------------------------
+StringPool::~StringPool()
+{
+    MemoryAccounting::sub(MemCategory::STRING_POOL, reserved);
+}
+
+// ------------------------------------------------------- add --------------------------------------------------------
+std::string_view StringPool::add(std::string_view s)
+{
+    if (s.empty()) return std::string_view(EMPTY, 0);
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto it = views.find(s);
+    if (it != views.end()) return *it;
+
+    char *dst = nullptr;
+    if (s.size() > MIN_BLOCK / 4)
+    {
+        // Oversized: dedicated block, inserted before the current one so bump allocation continues there.
+        std::unique_ptr<char[]> big(new char[s.size()]);
+        dst = big.get();
+        blocks.insert(blocks.empty() ? blocks.end() : blocks.end() - 1, std::move(big));
+        reserved += s.size();
+        MemoryAccounting::add(MemCategory::STRING_POOL, s.size());
+    }
+    else
+    {
+        if (used + s.size() > blockSize)
+        {
+            // Each new block matches what is reserved so far (capped), so at most half the arena is ever unused.
+            blockSize = std::min(std::max(reserved, MIN_BLOCK), MAX_BLOCK);
+            blocks.emplace_back(new char[blockSize]);
+            used      = 0;
+            reserved += blockSize;
+            MemoryAccounting::add(MemCategory::STRING_POOL, blockSize);
+        }
+        dst = blocks.back().get() + used;
+        used += s.size();
+    }
+
+    std::memcpy(dst, s.data(), s.size());
+    chars += s.size();
+
+    std::string_view view(dst, s.size());
+    views.insert(view);
+    return view;
+}
+
+// ------------------------------------------------------- find -------------------------------------------------------
+bool StringPool::find(std::string_view s, std::string_view &out) const
+{
+    if (s.empty())
+    {
+        out = std::string_view(EMPTY, 0);
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto it = views.find(s);
+    if (it == views.end()) return false;
+    out = *it;
+    return true;
+}
+
+// ------------------------------------------------- current / Use ----------------------------------------------------
+StringPool*& StringPool::current()
+{
+    static StringPool fallback;
+    thread_local StringPool *bound = &fallback;
+    return bound;
+}
+
+std::string_view StringPool::intern(std::string_view s)
+{
+    return current()->add(s);
+}
+
+bool StringPool::lookup(std::string_view s, std::string_view &out)
+{
+    return current()->find(s, out);
+}
+
+StringPool::Use::Use(StringPool &pool) : prev(current())
+{
+    current() = &pool;
+}
+
+StringPool::Use::~Use()
+{
+    current() = prev;
+}
+
+// ---------------------------------------------------- statistics ----------------------------------------------------
+size_t StringPool::distinctCount() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return views.size();
+}
+
+size_t StringPool::stringBytes() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return chars;
+}
+
+size_t StringPool::arenaBytes() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return reserved;
+}
@@ -0,0 +1,98 @@
+// --------------------------------------------------- StringPool.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: String interner for catalog text. Each distinct string is copied once into an append-only arena and
+//          handed out as a std::string_view that stays valid for the life of the pool, so titles, directors, actor
+//          names and inventory keys are shared instead of copied per owner.
+// Notes  : - Every Inventory owns a pool and binds it (Use) while it parses and indexes movies, so each store's
+//            catalog is interned, locked and freed on its own. The static intern()/lookup() go to the pool bound
+//            on the calling thread, or to a process-wide fallback pool when none is.
+//          - Two views from the same pool are equal exactly when their data() pointers are equal (see same()).
+//          - Arena blocks are allocated on first use: MIN_BLOCK first, then each as large as the arena so far, up to
+//            MAX_BLOCK.
+//          - One mutex per pool: only an inventory's loader and its reload thread ever intern concurrently.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include "MemoryAccounting.h"   // arena/table accounting
+
+#include <cstddef>        // size_t
+#include <memory>         // std::unique_ptr arena blocks
+#include <mutex>          // pool lock
+#include <string_view>    // interned handles
+#include <unordered_set>  // lookup table
+#include <vector>         // arena block list
+
+class StringPool
+{
+public:
+    static constexpr size_t MIN_BLOCK = 1024;        // first arena block; strings over a quarter of it get their own
+    static constexpr size_t MAX_BLOCK = 16 * 1024;   // block size cap
+
+    StringPool() = default;
+    ~StringPool();
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    // --------------------------------------------------- add --------------------------------------------------------
+    // Description: Canonical copy of s in this pool, inserting it on first use.
+    // Returns    : A view into the arena; equal strings always yield the same data() pointer.
+    std::string_view add(std::string_view s);
+
+    // --------------------------------------------------- find -------------------------------------------------------
+    // Description: Canonical copy of s if this pool holds it; never inserts.
+    // Returns    : true and sets out when found.
+    bool find(std::string_view s, std::string_view &out) const;
+
+    // ------------------------------------------------- intern / lookup ----------------------------------------------
+    // Description: add() / find() on the pool bound to the calling thread (see Use).
+    static std::string_view intern(std::string_view s);
+    static bool             lookup(std::string_view s, std::string_view &out);
+
+    // --------------------------------------------------- same -------------------------------------------------------
+    // Description: O(1) equality for two views interned in the same pool.
+    static bool same(std::string_view a, std::string_view b)
+    {
+        return a.data() == b.data() && a.size() == b.size();
+    }
+
+    // ---------------------------------------------------- Use -------------------------------------------------------
+    // Description: RAII binding of intern()/lookup() to pool for the calling thread; restores the previous binding
+    //              on scope exit.
+    class Use
+    {
+    public:
+        explicit Use(StringPool &pool);
+        ~Use();
+
+        Use(const Use&) = delete;
+        Use& operator=(const Use&) = delete;
+
+    private:
+        StringPool *prev;
+    };
+
+    // ------------------------------------------------ statistics ----------------------------------------------------
+    size_t distinctCount() const;   // distinct strings interned
+    size_t stringBytes() const;     // characters stored (one copy per distinct string)
+    size_t arenaBytes() const;      // bytes reserved by arena blocks
+
+private:
+    static StringPool*& current();
+
+    mutable std::mutex                   lock;
+    std::unordered_set<std::string_view, std::hash<std::string_view>, std::equal_to<std::string_view>,
+                       CountingAllocator<std::string_view, MemCategory::STRING_POOL>> views;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t                               blockSize = 0;   // size of blocks.back(); 0 until the first string
+    size_t                               used      = 0;   // bytes used in blocks.back()
+    size_t                               chars     = 0;
+    size_t                               reserved  = 0;
+};
+
+#endif // STRINGPOOL_H
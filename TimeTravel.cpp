@@ -0,0 +1,187 @@
+// -------------------------------------------------- TimeTravel.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Checkpoint series recording and nearest-checkpoint "as of" replay (see TimeTravel.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "TimeTravel.h"
+#include "Inventory.h"
+#include "CustomerHashTable.h"
+#include "CommandProcessor.h"
+#include "CommandFactory.h"
+#include "Command.h"
+#include "LineScanner.h"
+#include "Output.h"
+
+#include <algorithm>    // std::upper_bound
+#include <chrono>       // query timing
+#include <cstdio>       // std::remove
+#include <filesystem>   // history directory
+#include <fstream>
+#include <iomanip>      // timing precision
+#include <iostream>     // std::endl
+#include <sstream>
+
+static const char *const MAGIC = "MOVIES_HISTORY 1";
+
+using Clock = std::chrono::steady_clock;
+
+// ---------------------------------------------------- helpers -------------------------------------------------------
+static std::string indexPath(const std::string &dir)
+{
+    return dir + "/index";
+}
+
+// Run one report command ("I", "O <id>", "H <id>") against the restored state.
+static void runReport(const std::string &line, Inventory &inventory, CustomerHashTable &customers)
+{
+    Command *cmd = CommandFactory::createCommand(line);
+    if (!cmd) return;
+    cmd->execute(inventory, customers);
+    delete cmd;
+}
+
+// ---------------------------------------------------- readIndex -----------------------------------------------------
+std::vector<std::pair<int, std::string>> TimeTravel::readIndex(const std::string &dir)
+{
+    std::vector<std::pair<int, std::string>> out;
+    std::ifstream in(indexPath(dir));
+    std::string line;
+    if (!std::getline(in, line) || line != MAGIC) return out;
+
+    while (std::getline(in, line))
+    {
+        std::istringstream ls(line);
+        int lineNo = 0;
+        std::string file;
+        if (ls >> lineNo >> file) out.emplace_back(lineNo, file);
+    }
+    return out;
+}
+
+// ------------------------------------------------------ start -------------------------------------------------------
+bool TimeTravel::start(const std::string &historyDir)
+{
+    dir = historyDir;
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    for (const auto &old : readIndex(dir))
+    {
+        std::remove((dir + "/" + old.second).c_str());
+    }
+
+    std::ofstream index(indexPath(dir), std::ios::trunc);
+    index << MAGIC << "\n";
+    if (!index)
+    {
+        Output::err() << "ERROR: cannot write history index: " << indexPath(dir) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ----------------------------------------------------- record -------------------------------------------------------
+bool TimeTravel::record(const Checkpoint::State &position, Inventory &inventory, CustomerHashTable &customers)
+{
+    const std::string file = "line_" + std::to_string(position.lineNo) + ".ckpt";
+    if (!Checkpoint::save(dir + "/" + file, position, inventory, customers)) return false;
+
+    // The index only ever names complete checkpoints: the file is in place before its entry is appended.
+    std::ofstream index(indexPath(dir), std::ios::app);
+    index << position.lineNo << " " << file << "\n";
+    index.flush();
+    if (!index)
+    {
+        Output::err() << "ERROR: cannot append to history index: " << indexPath(dir) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------ query -------------------------------------------------------
+int TimeTravel::query(const Query &q)
+{
+    const Clock::time_point start = Clock::now();
+
+    // Nearest checkpoint at or before the target line: the last index entry with lineNo <= asOf.
+    Checkpoint::State state;
+    std::string restoredFrom;
+    if (!q.historyDir.empty())
+    {
+        const auto index = readIndex(q.historyDir);
+        auto it = std::upper_bound(index.begin(), index.end(), q.asOf,
+                                   [](int line, const std::pair<int, std::string> &e) { return line < e.first; });
+        if (it != index.begin())
+        {
+            --it;
+            if (Checkpoint::read(q.historyDir + "/" + it->second, state)) restoredFrom = it->second;
+            else state = Checkpoint::State();
+        }
+    }
+
+    Inventory inventory;
+    CustomerHashTable customers;
+    inventory.setForegroundReloads(true);   // restored and replayed reloads stage in this thread
+    if (!restoredFrom.empty())
+    {
+        std::istringstream catalog(state.catalog);
+        inventory.loadMovies(catalog);
+    }
+    else
+    {
+        inventory.loadMovies(q.moviesFile);
+    }
+    if (!customers.loadCustomers(q.customersFile)) return 1;
+    if (!restoredFrom.empty()) Checkpoint::restoreLoans(state, inventory, customers);
+
+    LineReader commands;
+    if (!commands.open(q.commandsFile))
+    {
+        Output::err() << "ERROR: cannot open commands file: " << q.commandsFile << std::endl;
+        return 1;
+    }
+    int lineNo = 0;
+    if (!restoredFrom.empty())
+    {
+        commands.seek(state.offset);
+        lineNo = state.lineNo;
+    }
+
+    // Replay the gap with the commands' own output and completed log discarded, and without writing any file.
+    const int from = lineNo;
+    {
+        std::ostream discard(nullptr);
+        Output::Redirect quiet(discard, discard);
+        CommandProcessor processor(inventory, customers, discard);
+        processor.resumeCounts(state.executed, state.skipped);
+        processor.setReadOnly(true);
+
+        std::string_view view;
+        while (lineNo < q.asOf && commands.next(view))
+        {
+            processor.processLine(std::string(view), ++lineNo);
+        }
+    }
+    const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+    Output::err() << "[info] As of line " << q.asOf << ": "
+                  << (restoredFrom.empty() ? std::string("no checkpoint") : "restored " + restoredFrom)
+                  << " | replayed " << (lineNo - from) << " lines | " << std::fixed << std::setprecision(2)
+                  << ms << " ms" << std::endl;
+    if (lineNo < q.asOf)
+    {
+        Output::err() << "[info] Commands file ends at line " << lineNo << std::endl;
+    }
+
+    Output::out() << "=== State as of command line " << q.asOf << " ===" << std::endl;
+    runReport("I", inventory, customers);
+    if (q.forCustomer)
+    {
+        runReport("O " + std::to_string(q.customerId), inventory, customers);
+        runReport("H " + std::to_string(q.customerId), inventory, customers);
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+// --------------------------------------------------- TimeTravel.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: "As of command N" queries for audits. A recording run keeps a series of checkpoints (Checkpoint.h
+//          format) in a history directory, with an index from command line number to checkpoint file. A query
+//          restores the nearest checkpoint at or before line N and replays only the lines between it and N, so it
+//          costs O(checkpoint interval) instead of O(N).
+// Notes  : - Directory layout: "index" ("MOVIES_HISTORY 1", then one "<lineNo> <file>" per checkpoint, ascending)
+//            and one "line_<lineNo>.ckpt" per checkpoint. A new recording run replaces the previous series.
+//          - Without a history directory (or before the first checkpoint) a query replays from line 1.
+//          - The replayed commands' own output is discarded; the query prints the inventory ("I") and, for a
+//            customer, its loans ("O <id>") and history ("H <id>") as they stood after line N; a reload that was
+//            started but not yet due by then (see Inventory::startReload) is not applied.
+//          - A query writes no file and starts no thread: commands that write files (E) are skipped during the
+//            replay (CommandProcessor::setReadOnly), and reloads (L, and those pending in the checkpoint) read their
+//            delta file in the query's own thread when they come due (Inventory::setForegroundReloads). A reload
+//            with lag 0 is merged before the next command.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef TIMETRAVEL_H
+#define TIMETRAVEL_H
+
+#include "Checkpoint.h"
+
+#include <string>
+#include <utility>   // std::pair
+#include <vector>
+
+class Inventory;           // fwd decl
+class CustomerHashTable;   // fwd decl
+
+class TimeTravel
+{
+public:
+    // ---------------------------------------------------- start -----------------------------------------------------
+    // Description: Begin recording into dir (created if missing), replacing any previous series there.
+    // Returns    : false (with an error message) if the index cannot be written.
+    bool start(const std::string &dir);
+
+    // ---------------------------------------------------- record ----------------------------------------------------
+    // Description: Save a checkpoint for 'position' (see Checkpoint::save) and add it to the index.
+    bool record(const Checkpoint::State &position, Inventory &inventory, CustomerHashTable &customers);
+
+    // ---------------------------------------------------- query -----------------------------------------------------
+    struct Query
+    {
+        std::string moviesFile;
+        std::string customersFile;
+        std::string commandsFile;
+        std::string historyDir;             // empty = replay from the start
+        int         asOf        = 0;        // command line number
+        bool        forCustomer = false;
+        int         customerId  = 0;
+    };
+
+    // Description: Print the state as of q.asOf to stdout (timing and restore point on stderr).
+    // Returns    : process exit status (0 ok, 1 input files missing).
+    static int query(const Query &q);
+
+private:
+    // Description: (lineNo, file) entries of dir's index, ascending; empty if there is none.
+    static std::vector<std::pair<int, std::string>> readIndex(const std::string &dir);
+
+    std::string dir;
+};
+
+#endif // TIMETRAVEL_H
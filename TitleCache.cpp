@@ -0,0 +1,104 @@
+// -------------------------------------------------- TitleCache.cpp --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Set selection, verified hits, use-counter replacement and hit/miss counters (see TitleCache.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "TitleCache.h"
+
+static_assert((TitleCache::SLOTS & (TitleCache::SLOTS - 1)) == 0, "TitleCache::SLOTS must be a power of two");
+static_assert(TitleCache::SLOTS % TitleCache::WAYS == 0, "TitleCache::SLOTS must be a multiple of WAYS");
+
+// --------------------------------------------------- TitleCache -----------------------------------------------------
+TitleCache::TitleCache()
+    : sets(SLOTS / WAYS)
+{
+    static_assert(sizeof(Set) == 64, "a TitleCache set must fill exactly one cache line");
+}
+
+// ----------------------------------------------------- setFor -------------------------------------------------------
+// The Bloom filter picks its block from the high hash bits; the cache uses the low ones, mixed with the category
+// so equal keys in two genres do not share a set.
+TitleCache::Set& TitleCache::setFor(char category, uint64_t h)
+{
+    const uint64_t salt = static_cast<uint64_t>(static_cast<unsigned char>(category)) * 0x9E3779B97F4A7C15ull;
+    return sets[static_cast<size_t>(h ^ salt) & (SLOTS / WAYS - 1)];
+}
+
+bool TitleCache::matches(const Entry &e, char category, std::string_view key, uint64_t h)
+{
+    return e.movie && e.hash == h && e.category == category && std::string_view(e.key, e.keySize) == key;
+}
+
+// ------------------------------------------------------ find --------------------------------------------------------
+Movie* TitleCache::find(char category, std::string_view key, uint64_t h)
+{
+    for (Entry &e : setFor(category, h).ways)
+    {
+        if (!matches(e, category, key, h)) continue;
+        if (e.uses < MAX_USES) ++e.uses;
+        ++hits;
+        return e.movie;
+    }
+    ++misses;
+    return nullptr;
+}
+
+// ----------------------------------------------------- insert -------------------------------------------------------
+void TitleCache::insert(char category, std::string_view key, uint64_t h, Movie *movie)
+{
+    Set &set = setFor(category, h);
+    Entry *victim = &set.ways[0];
+    for (Entry &e : set.ways)
+    {
+        if (matches(e, category, key, h) || !e.movie)
+        {
+            victim = &e;
+            break;
+        }
+        if (e.uses < victim->uses) victim = &e;
+    }
+
+    if (victim->movie && !matches(*victim, category, key, h))
+    {
+        // A used entry stays; it loses a point on every AGE_EVERY-th miss and is displaced once it reaches zero.
+        if (victim->uses > 0)
+        {
+            if ((misses & (AGE_EVERY - 1)) == 0) --victim->uses;
+            ++declined;
+            return;
+        }
+        ++replaced;
+    }
+    victim->hash     = h;
+    victim->movie    = movie;
+    victim->key      = key.data();
+    victim->keySize  = static_cast<uint32_t>(key.size());
+    victim->category = category;
+    victim->uses     = 0;
+}
+
+// ------------------------------------------------------ evict -------------------------------------------------------
+void TitleCache::evict(char category, std::string_view key, uint64_t h)
+{
+    for (Entry &e : setFor(category, h).ways)
+    {
+        if (matches(e, category, key, h)) e = Entry();
+    }
+}
+
+// --------------------------------------------------- getStats -------------------------------------------------------
+TitleCache::Stats TitleCache::getStats() const
+{
+    size_t used = 0;
+    for (const Set &set : sets)
+    {
+        for (const Entry &e : set.ways)
+        {
+            if (e.movie) ++used;
+        }
+    }
+    return Stats{SLOTS, used, hits, misses, replaced, declined};
+}
@@ -0,0 +1,92 @@
+// -------------------------------------------------- TitleCache.h ----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Small set-associative cache from (category, canonical key) to Movie*, checked by Inventory's borrow,
+//          return and restock paths before the Bloom filter and the two map descents. Borrows follow a power law,
+//          so a few hundred slots catch most of the traffic.
+// Notes  : - The key's 64-bit hash picks a set of two 32-byte entries, one 64-byte cache line, so a probe touches
+//            one line; a hit is confirmed by comparing category, hash and the key text itself.
+//          - Replacement is CLOCK-like: each entry has a small use counter, raised on hits. A miss only displaces
+//            an entry whose counter has run down to zero; every AGE_EVERY-th miss instead ages the set's lighter
+//            entry by one. The long tail of one-off titles therefore cannot flush the hot ones out, while a title
+//            that cools down is still replaced eventually.
+//          - Keys are stored as views of the inventory's interned map keys, which live as long as the inventory.
+//          - Only found titles are cached; a title that moves to another Movie must be evicted by the owner.
+//          - Not thread-safe: owned by one Inventory and used only on its (single-threaded) command path.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef TITLECACHE_H
+#define TITLECACHE_H
+
+#include <cstddef>       // size_t
+#include <cstdint>       // uint64_t hashes and counters
+#include <string_view>
+#include <vector>
+
+class Movie;   // fwd decl
+
+class TitleCache
+{
+public:
+    static constexpr size_t SLOTS = 512;   // power of two; 16 KiB of entries
+    static constexpr size_t WAYS  = 2;     // entries per set (one cache line)
+
+    TitleCache();
+
+    // ----------------------------------------------------- find -----------------------------------------------------
+    // Description: Cached movie for category + key (h = BloomFilter::hash(key)), or nullptr; counts a hit or miss.
+    Movie* find(char category, std::string_view key, uint64_t h);
+
+    // ---------------------------------------------------- insert ----------------------------------------------------
+    // Description: Offer movie for category + key after a miss: it takes a free or fully aged entry of its set,
+    //              or is declined (see Notes). 'key' must stay valid for the cache's lifetime (an interned key).
+    void insert(char category, std::string_view key, uint64_t h, Movie *movie);
+
+    // ---------------------------------------------------- evict -----------------------------------------------------
+    // Description: Drop category + key if cached.
+    void evict(char category, std::string_view key, uint64_t h);
+
+    // ------------------------------------------------ statistics ----------------------------------------------------
+    struct Stats
+    {
+        size_t   slots;
+        size_t   used;
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t replaced;   // inserts that displaced another title
+        uint64_t declined;   // inserts refused because the set's entries were still in use
+    };
+    Stats getStats() const;
+
+private:
+    static constexpr uint8_t  MAX_USES  = 3;
+    static constexpr uint64_t AGE_EVERY = 16;   // power of two
+
+    struct Entry
+    {
+        uint64_t    hash     = 0;
+        Movie      *movie    = nullptr;   // nullptr = empty entry
+        const char *key      = nullptr;
+        uint32_t    keySize  = 0;
+        char        category = 0;
+        uint8_t     uses     = 0;         // saturating hit counter, aged by misses
+    };
+
+    struct alignas(64) Set
+    {
+        Entry ways[WAYS];
+    };
+
+    Set& setFor(char category, uint64_t h);
+    static bool matches(const Entry &e, char category, std::string_view key, uint64_t h);
+
+    std::vector<Set> sets;
+    uint64_t         hits     = 0;
+    uint64_t         misses   = 0;
+    uint64_t         replaced = 0;
+    uint64_t         declined = 0;
+};
+
+#endif // TITLECACHE_H
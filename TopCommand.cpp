@@ -0,0 +1,29 @@
+// -------------------------------------------------- TopCommand.cpp --------------------------------------------------
+// Prints the heavy-hitter titles tracked by PopularityTracker.
+
+#include "TopCommand.h"
+#include "Inventory.h"
+#include "MovieFactory.h"
+#include "Output.h"
+#include <iostream>
+#include <vector>
+
+void TopCommand::execute(Inventory &inventory, CustomerHashTable &) const
+{
+    PopularityTracker &pop = inventory.getPopularity();
+    const std::vector<PopularityTracker::Entry> entries = pop.top(category, k, inventory.getCommandSeq());
+
+    const GenreInfo *genre = MovieFactory::findGenre(category);
+    Output::out() << "Top borrowed (" << (genre ? genre->label : "all genres")
+                  << ", window " << pop.getWindow() << " commands):" << std::endl;
+    if (entries.empty())
+    {
+        Output::out() << "  (no borrows)" << std::endl;
+        return;
+    }
+    for (const auto &e : entries)
+    {
+        Output::out() << "  " << e.estimate << " total, " << e.window << " recent | ";
+        e.movie->display();
+    }
+}
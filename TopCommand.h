@@ -0,0 +1,38 @@
+// --------------------------------------------------- TopCommand.h ---------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Command that prints the most-borrowed titles overall or for one genre, from the inventory's streaming
+//          popularity engine. Line format: "T [genreCode] [k]" (defaults: all genres, k = 10).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef TOPCOMMAND_H
+#define TOPCOMMAND_H
+
+#include "Command.h"
+#include <cstddef>   // size_t
+
+class TopCommand : public Command
+{
+public:
+    // category 0 = all genres
+    TopCommand(char category, size_t k)
+        : category(category),
+          k(k)
+    {
+    }
+
+    // --------------------------------------------------------------------------------------------------------------
+    // execute
+    // Post: Prints a heading, then one line per title: all-time estimate, borrows within the sliding window, and
+    //       the movie's current listing; or "  (no borrows)".
+    // --------------------------------------------------------------------------------------------------------------
+    void execute(Inventory &inventory, CustomerHashTable &customers) const override;
+
+private:
+    char   category;
+    size_t k;
+};
+
+#endif // TOPCOMMAND_H
@@ -0,0 +1,129 @@
+// ------------------------------------------------- TrigramIndex.cpp -------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose : Trigram extraction, posting-list maintenance and similarity search (see TrigramIndex.h).
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "TrigramIndex.h"
+#include "classics.h"
+
+#include <algorithm>  // std::sort, std::unique, std::partial_sort
+#include <cctype>     // std::isalnum, std::tolower
+#include <cmath>      // std::sqrt
+
+// --------------------------------------------------- normalize ------------------------------------------------------
+std::string TrigramIndex::normalize(const std::string &text)
+{
+    std::string out;
+    out.reserve(text.size());
+    bool pendingSpace = false;
+    for (unsigned char ch : text)
+    {
+        if (std::isalnum(ch))
+        {
+            if (pendingSpace && !out.empty()) out.push_back(' ');
+            pendingSpace = false;
+            out.push_back(static_cast<char>(std::tolower(ch)));
+        }
+        else
+        {
+            pendingSpace = true;
+        }
+    }
+    return out;
+}
+
+// --------------------------------------------------- trigramsOf -----------------------------------------------------
+std::vector<uint32_t> TrigramIndex::trigramsOf(const std::string &text)
+{
+    const std::string norm = normalize(text);
+    std::vector<uint32_t> grams;
+
+    size_t b = 0;
+    while (b < norm.size())
+    {
+        size_t e = norm.find(' ', b);
+        if (e == std::string::npos) e = norm.size();
+
+        const std::string word = "  " + norm.substr(b, e - b) + " ";
+        for (size_t i = 0; i + 3 <= word.size(); ++i)
+        {
+            grams.push_back((static_cast<uint32_t>(static_cast<unsigned char>(word[i]))     << 16)
+                          | (static_cast<uint32_t>(static_cast<unsigned char>(word[i + 1])) << 8)
+                          |  static_cast<uint32_t>(static_cast<unsigned char>(word[i + 2])));
+        }
+        b = e + 1;
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+// ------------------------------------------------------ add ---------------------------------------------------------
+std::vector<uint32_t> TrigramIndex::trigramsOf(const Movie *movie)
+{
+    std::string text = std::string(movie->getTitle()) + " " + std::string(movie->getDirector());
+    if (const Classics *c = dynamic_cast<const Classics*>(movie))
+    {
+        text += " " + std::string(c->getMajorActorFirst()) + " " + std::string(c->getMajorActorLast());
+    }
+    return trigramsOf(text);
+}
+
+void TrigramIndex::add(const Movie *movie, const std::vector<uint32_t> &grams)
+{
+    const uint32_t slot = static_cast<uint32_t>(movie->getSlot());
+    if (docs.size() <= slot) docs.resize(slot + 1);
+    docs[slot].movie        = movie;
+    docs[slot].trigramCount = static_cast<uint32_t>(grams.size());
+
+    for (uint32_t g : grams)
+    {
+        postings[g].push_back(slot);   // slots are assigned in increasing order
+    }
+}
+
+// ----------------------------------------------------- search -------------------------------------------------------
+std::vector<TrigramIndex::Match> TrigramIndex::search(const std::string &text, size_t k, double minScore) const
+{
+    std::vector<Match> result;
+    const std::vector<uint32_t> grams = trigramsOf(text);
+    if (grams.empty() || k == 0) return result;
+
+    // Count shared trigrams for every movie reachable from the query's posting lists.
+    std::unordered_map<uint32_t, uint32_t> shared;
+    for (uint32_t g : grams)
+    {
+        auto it = postings.find(g);
+        if (it == postings.end()) continue;
+        for (uint32_t slot : it->second)
+        {
+            ++shared[slot];
+        }
+    }
+
+    const double q = static_cast<double>(grams.size());
+    for (const auto &kv : shared)
+    {
+        const Doc &d = docs[kv.first];
+        const double score = kv.second / std::sqrt(q * d.trigramCount);
+        if (score >= minScore) result.push_back(Match{d.movie, score});
+    }
+
+    auto better = [](const Match &a, const Match &b)
+    {
+        if (a.score != b.score) return a.score > b.score;
+        if (a.movie->getCategory() != b.movie->getCategory())
+        {
+            return a.movie->getCategory() < b.movie->getCategory();
+        }
+        return a.movie->buildKey() < b.movie->buildKey();
+    };
+    const size_t n = std::min(k, result.size());
+    std::partial_sort(result.begin(), result.begin() + n, result.end(), better);
+    result.resize(n);
+    return result;
+}
@@ -0,0 +1,63 @@
+// -------------------------------------------------- TrigramIndex.h --------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Inverted index from character trigrams to movies, over normalized titles, directors and (for Classics)
+//          major actors. Backs "did you mean" suggestions for failed borrows and the S (search) command.
+// Notes  : - Documents are addressed by Movie::getSlot(), so the index grows alongside Inventory::inventoryMap.
+//          - A query only visits the posting lists of its own trigrams, so cost depends on how many movies share
+//            trigrams with the query rather than on catalog size. Scores are cosine similarity between the
+//            query's and the movie's trigram sets.
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include "movie.h"
+#include <cstddef>         // size_t
+#include <cstdint>         // uint32_t trigram codes / doc ids
+#include <string>
+#include <unordered_map>   // trigram -> postings
+#include <vector>
+
+class TrigramIndex
+{
+public:
+    struct Match
+    {
+        const Movie *movie;
+        double       score;   // (0, 1]; 1 = identical trigram sets
+    };
+
+    // ----------------------------------------------------- add ------------------------------------------------------
+    // Description: Index a newly stocked movie (must already have its inventory slot assigned) under 'grams', the
+    //              movie's trigramsOf(); those can be computed ahead of time, e.g. on a reload's parse thread.
+    void add(const Movie *movie, const std::vector<uint32_t> &grams);
+
+    // Description: Distinct trigram codes of a movie's title, director and (Classics) major actor.
+    static std::vector<uint32_t> trigramsOf(const Movie *movie);
+
+    // ---------------------------------------------------- search ----------------------------------------------------
+    // Description: Up to k best matches scoring at least minScore, best first (ties: category, then key).
+    std::vector<Match> search(const std::string &text, size_t k, double minScore) const;
+
+    // -------------------------------------------------- normalize ---------------------------------------------------
+    // Description: Lower-case, map punctuation to spaces, and collapse runs of whitespace.
+    static std::string normalize(const std::string &text);
+
+private:
+    // Distinct trigram codes of normalized 'text' (each word padded as "  word ").
+    static std::vector<uint32_t> trigramsOf(const std::string &text);
+
+    struct Doc
+    {
+        const Movie *movie        = nullptr;
+        uint32_t     trigramCount = 0;
+    };
+
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings;   // trigram -> slots, ascending
+    std::vector<Doc>                                    docs;       // by slot
+};
+
+#endif // TRIGRAMINDEX_H
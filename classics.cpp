@@ -8,12 +8,15 @@
 
 #include "classics.h"
 #include "movie.h"
-#include <iostream>   // streaming of display()
-#include <sstream>    // key formatting
-#include <iomanip>    // std::setw, std::setfill for zero-padded month (per spec)
+#include "Output.h"
+#include "StringPool.h"
+#include <iostream>   // streaming of print()
+#include <sstream>    // tail parsing
+#include <string>     // key assembly
 
 // ------------------------------------------------ Classics ----------------------------------------------------------
-Classics::Classics() : Movie(), releaseMonth(0), majorActorFirst(""), majorActorLast("")
+Classics::Classics()
+    : Movie(), releaseMonth(0), majorActorFirst(StringPool::intern("")), majorActorLast(StringPool::intern(""))
 {
 } // end of Classics default ctor
 
@@ -23,23 +26,45 @@ Classics::Classics(const std::string &title, int stock, const std::string &direc
                    const std::string &majorActorFirst, const std::string &majorActorLast)
     : Movie(title, stock, director, year),
       releaseMonth(releaseMonth),
-      majorActorFirst(majorActorFirst),
-      majorActorLast(majorActorLast)
+      majorActorFirst(StringPool::intern(majorActorFirst)),
+      majorActorLast(StringPool::intern(majorActorLast))
 {
 } // end of Classics(value) ctor
 
+// -------------------------------------------------- parse -----------------------------------------------------------
+Movie* Classics::parse(const std::string &title, int stock, const std::string &director,
+                       const std::string &tail, std::string &error)
+{
+    // tail = "ActorFirst ActorLast month year"
+    std::istringstream tss(tail);
+    std::string actorFirst, actorLast;
+    int month = 0, year = 0;
+
+    if (!(tss >> actorFirst >> actorLast >> month >> year))
+    {
+        error = "invalid classics tail";
+        return nullptr;
+    }
+    if (month < 1 || month > 12)
+    {
+        error = "invalid month";
+        return nullptr;
+    }
+    return new Classics(title, stock, director, month, year, actorFirst, actorLast);
+} // end of parse
+
 // ------------------------------------------------ ~Classics ---------------------------------------------------------
 Classics::~Classics()
 {
 } // end of ~Classics
 
-// ------------------------------------------------- display ----------------------------------------------------------
-void Classics::display() const
+// ------------------------------------------------- print ------------------------------------------------------------
+void Classics::print(int shownStock) const
 {
-    std::cout << "C, " << stock << ", " << director << ", " << title << ", "
-              << majorActorFirst << " " << majorActorLast << " "
-              << releaseMonth << " " << year << std::endl;
-} // end of display
+    Output::out() << "C, " << shownStock << ", " << director << ", " << title << ", "
+                  << majorActorFirst << " " << majorActorLast << " "
+                  << releaseMonth << " " << year << std::endl;
+} // end of print
 
 // ------------------------------------------------ operator< ---------------------------------------------------------
 bool Classics::operator<(const Movie *other) const
@@ -48,8 +73,9 @@ bool Classics::operator<(const Movie *other) const
     if (!o) return false;
     if (year != o->year) return year < o->year;
     if (releaseMonth != o->releaseMonth) return releaseMonth < o->releaseMonth;
-    const std::string a = majorActorFirst + " " + majorActorLast;
-    const std::string b = o->majorActorFirst + " " + o->majorActorLast;
+    if (StringPool::same(majorActorFirst, o->majorActorFirst)) return majorActorLast < o->majorActorLast;
+    const std::string a = std::string(majorActorFirst) + " " + std::string(majorActorLast);
+    const std::string b = std::string(o->majorActorFirst) + " " + std::string(o->majorActorLast);
     return a < b;
 } // end of operator<
 
@@ -59,8 +85,8 @@ bool Classics::operator==(const Movie *other) const
     const Classics *o = dynamic_cast<const Classics*>(other);
     return o && year == o->year
              && releaseMonth == o->releaseMonth
-             && majorActorFirst == o->majorActorFirst
-             && majorActorLast  == o->majorActorLast;
+             && StringPool::same(majorActorFirst, o->majorActorFirst)
+             && StringPool::same(majorActorLast,  o->majorActorLast);
 } // end of operator==
 
 // ------------------------------------------------ getCategory -------------------------------------------------------
@@ -72,10 +98,15 @@ char Classics::getCategory() const
 // ------------------------------------------------- buildKey ---------------------------------------------------------
 std::string Classics::buildKey() const
 {
-    std::ostringstream oss;
-    oss << year << "-" << std::setw(2) << std::setfill('0') << releaseMonth
-        << "|" << majorActorFirst << " " << majorActorLast;
-    return oss.str();
+    // "YYYY-MM|First Last", assembled in place (no stream formatting)
+    std::string key = std::to_string(year);
+    key.reserve(key.size() + 5 + majorActorFirst.size() + majorActorLast.size());
+    key += '-';
+    key += static_cast<char>('0' + releaseMonth / 10);
+    key += static_cast<char>('0' + releaseMonth % 10);
+    key += '|';
+    key.append(majorActorFirst).append(" ").append(majorActorLast);
+    return key;
 } // end of buildKey
 
 // ------------------------------------------------- accessors --------------------------------------------------------
@@ -84,12 +115,12 @@ int Classics::getReleaseMonth() const
     return releaseMonth;
 } // end of getReleaseMonth
 
-std::string Classics::getMajorActorFirst() const
+std::string_view Classics::getMajorActorFirst() const
 {
     return majorActorFirst;
 } // end of getMajorActorFirst
 
-std::string Classics::getMajorActorLast() const
+std::string_view Classics::getMajorActorLast() const
 {
     return majorActorLast;
 } // end of getMajorActorLast
@@ -22,11 +22,18 @@ public:
              const std::string &director, int releaseMonth,
              int year, const std::string &majorActorFirst, const std::string &majorActorLast);
 
+    // ------------------------------------------------ parse ---------------------------------------------------------
+    // Description: Build a Classics from the loader's common fields plus the genre-specific line tail
+    //              ("First Last Month Year").
+    // Returns    : New Classics (caller owns), or nullptr with 'error' set to the reason.
+    static Movie* parse(const std::string &title, int stock, const std::string &director,
+                        const std::string &tail, std::string &error);
+
     // ------------------------------------------------ ~Classics -----------------------------------------------------
     virtual ~Classics() override;
 
-    // ------------------------------------------------ display -------------------------------------------------------
-    void display() const override;
+    // ------------------------------------------------ print ---------------------------------------------------------
+    void print(int shownStock) const override;
 
     // --------------------------------------------- comparisons ------------------------------------------------------
     bool operator<(const Movie *other) const override;
@@ -37,14 +44,14 @@ public:
     std::string buildKey()    const override;
 
     // --------------------------------------------- accessors --------------------------------------------------------
-    int         getReleaseMonth()   const;
-    std::string getMajorActorFirst() const;
-    std::string getMajorActorLast()  const;
+    int              getReleaseMonth()    const;
+    std::string_view getMajorActorFirst() const;   // interned
+    std::string_view getMajorActorLast()  const;   // interned
 
 private:
-    int         releaseMonth;
-    std::string majorActorFirst;
-    std::string majorActorLast;
+    int              releaseMonth;
+    std::string_view majorActorFirst;
+    std::string_view majorActorLast;
 };
 
 #endif // CLASSICS_H
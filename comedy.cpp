@@ -8,7 +8,9 @@
 
 #include "comedy.h"
 #include "movie.h"
-#include <iostream>   // streaming of display()
+#include "Output.h"
+#include "StringPool.h"
+#include <iostream>   // streaming of print()
 #include <sstream>    // key formatting
 
 // ------------------------------------------------ Comedy ------------------------------------------------------------
@@ -22,23 +24,37 @@ Comedy::Comedy(const std::string &title, int stock, const std::string &director,
 {
 } // end of Comedy(value) ctor
 
+// ------------------------------------------------- parse ------------------------------------------------------------
+Movie* Comedy::parse(const std::string &title, int stock, const std::string &director,
+                     const std::string &tail, std::string &error)
+{
+    // tail should be the year
+    int year = 0;
+    if (!parseInt(tail, year))
+    {
+        error = "invalid year";
+        return nullptr;
+    }
+    return new Comedy(title, stock, director, year);
+} // end of parse
+
 // ------------------------------------------------ ~Comedy -----------------------------------------------------------
 Comedy::~Comedy()
 {
 } // end of ~Comedy
 
-// ------------------------------------------------ display -----------------------------------------------------------
-void Comedy::display() const
+// ------------------------------------------------ print -------------------------------------------------------------
+void Comedy::print(int shownStock) const
 {
-    std::cout << "F, " << stock << ", " << director << ", " << title << ", " << year << std::endl;
-} // end of display
+    Output::out() << "F, " << shownStock << ", " << director << ", " << title << ", " << year << std::endl;
+} // end of print
 
 // ----------------------------------------------- operator< ----------------------------------------------------------
 bool Comedy::operator<(const Movie *other) const
 {
     const Comedy *o = dynamic_cast<const Comedy*>(other);
     if (!o) return false;                    // define cross-type ordering
-    if (title != o->title) return title < o->title;
+    if (!StringPool::same(title, o->title)) return title < o->title;
     return year < o->year;
 } // end of operator<
 
@@ -46,7 +62,7 @@ bool Comedy::operator<(const Movie *other) const
 bool Comedy::operator==(const Movie *other) const
 {
     const Comedy *o = dynamic_cast<const Comedy*>(other);
-    return o && title == o->title && year == o->year;
+    return o && StringPool::same(title, o->title) && year == o->year;
 } // end of operator==
 
 // ---------------------------------------------- getCategory ---------------------------------------------------------
@@ -21,11 +21,17 @@ public:
     Comedy(const std::string &title, int stock,
            const std::string &director, int year);
 
+    // ------------------------------------------------ parse ---------------------------------------------------------
+    // Description: Build a Comedy from the loader's common fields plus the genre-specific line tail ("Year").
+    // Returns    : New Comedy (caller owns), or nullptr with 'error' set to the reason.
+    static Movie* parse(const std::string &title, int stock, const std::string &director,
+                        const std::string &tail, std::string &error);
+
     // ---------------------------------------------- ~Comedy ---------------------------------------------------------
     virtual ~Comedy() override;
 
-    // ---------------------------------------------- display ---------------------------------------------------------
-    void display() const override;
+    // ---------------------------------------------- print -----------------------------------------------------------
+    void print(int shownStock) const override;
 
     // --------------------------------------------- comparisons ------------------------------------------------------
     bool operator<(const Movie *other) const override;
@@ -0,0 +1,80 @@
+// ----------------------------------------------- documentary.cpp ----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Concrete Documentary implementation. Sorts by Title→Year; key = "Title|Year".
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "documentary.h"
+#include "movie.h"
+#include "Output.h"
+#include "StringPool.h"
+#include <iostream>   // streaming of print()
+#include <sstream>    // key formatting
+
+// ---------------------------------------------- Documentary ---------------------------------------------------------
+Documentary::Documentary() : Movie()
+{
+} // end of Documentary default ctor
+
+// ------------------------------------------ Documentary (overload) --------------------------------------------------
+Documentary::Documentary(const std::string &title, int stock, const std::string &director, int year)
+    : Movie(title, stock, director, year)
+{
+} // end of Documentary(value) ctor
+
+// ------------------------------------------------- parse ------------------------------------------------------------
+Movie* Documentary::parse(const std::string &title, int stock, const std::string &director,
+                          const std::string &tail, std::string &error)
+{
+    // tail should be the year
+    int year = 0;
+    if (!parseInt(tail, year))
+    {
+        error = "invalid year";
+        return nullptr;
+    }
+    return new Documentary(title, stock, director, year);
+} // end of parse
+
+// --------------------------------------------- ~Documentary ---------------------------------------------------------
+Documentary::~Documentary()
+{
+} // end of ~Documentary
+
+// ------------------------------------------------- print ------------------------------------------------------------
+void Documentary::print(int shownStock) const
+{
+    Output::out() << "N, " << shownStock << ", " << director << ", " << title << ", " << year << std::endl;
+} // end of print
+
+// ----------------------------------------------- operator< ----------------------------------------------------------
+bool Documentary::operator<(const Movie *other) const
+{
+    const Documentary *o = dynamic_cast<const Documentary*>(other);
+    if (!o) return false;
+    if (!StringPool::same(title, o->title)) return title < o->title;
+    return year < o->year;
+} // end of operator<
+
+// ---------------------------------------------- operator== ----------------------------------------------------------
+bool Documentary::operator==(const Movie *other) const
+{
+    const Documentary *o = dynamic_cast<const Documentary*>(other);
+    return o && StringPool::same(title, o->title) && year == o->year;
+} // end of operator==
+
+// ---------------------------------------------- getCategory ---------------------------------------------------------
+char Documentary::getCategory() const
+{
+    return 'N';
+} // end of getCategory
+
+// ----------------------------------------------- buildKey -----------------------------------------------------------
+std::string Documentary::buildKey() const
+{
+    std::ostringstream oss;
+    oss << title << "|" << year;
+    return oss.str();
+} // end of buildKey
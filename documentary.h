@@ -0,0 +1,46 @@
+// ------------------------------------------------ documentary.h -----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Documentary movies (code 'N'); ordering by Title then Year. Inventory key is "Title|Year".
+//          Movies line: "N, Stock, Director, Title, Year".
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef DOCUMENTARY_H
+#define DOCUMENTARY_H
+
+#include "movie.h"
+#include <string>
+
+class Documentary : public Movie {
+public:
+    // ----------------------------------------------- Documentary ----------------------------------------------------
+    Documentary();
+
+    // ------------------------------------------ Documentary (overload) ----------------------------------------------
+    Documentary(const std::string &title, int stock,
+                const std::string &director, int year);
+
+    // ------------------------------------------------ parse ---------------------------------------------------------
+    // Description: Build a Documentary from the loader's common fields plus the genre-specific line tail ("Year").
+    // Returns    : New Documentary (caller owns), or nullptr with 'error' set to the reason.
+    static Movie* parse(const std::string &title, int stock, const std::string &director,
+                        const std::string &tail, std::string &error);
+
+    // ---------------------------------------------- ~Documentary ----------------------------------------------------
+    virtual ~Documentary() override;
+
+    // ------------------------------------------------ print ---------------------------------------------------------
+    void print(int shownStock) const override;
+
+    // --------------------------------------------- comparisons ------------------------------------------------------
+    bool operator<(const Movie *other) const override;
+    bool operator==(const Movie *other) const override;
+
+    // ------------------------------------------------ metadata ------------------------------------------------------
+    char        getCategory() const override;
+    std::string buildKey()    const override;
+};
+
+#endif // DOCUMENTARY_H
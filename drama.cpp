@@ -8,7 +8,9 @@
 
 #include "drama.h"
 #include "movie.h"
-#include <iostream>   // streaming of display()
+#include "Output.h"
+#include "StringPool.h"
+#include <iostream>   // streaming of print()
 
 // ------------------------------------------------- Drama ------------------------------------------------------------
 Drama::Drama() : Movie()
@@ -21,23 +23,37 @@ Drama::Drama(const std::string &title, int stock, const std::string &director, i
 {
 } // end of Drama(value) ctor
 
+// ------------------------------------------------- parse ------------------------------------------------------------
+Movie* Drama::parse(const std::string &title, int stock, const std::string &director,
+                    const std::string &tail, std::string &error)
+{
+    // tail should be the year
+    int year = 0;
+    if (!parseInt(tail, year))
+    {
+        error = "invalid year";
+        return nullptr;
+    }
+    return new Drama(title, stock, director, year);
+} // end of parse
+
 // ------------------------------------------------- ~Drama -----------------------------------------------------------
 Drama::~Drama()
 {
 } // end of ~Drama
 
-// ------------------------------------------------- display ----------------------------------------------------------
-void Drama::display() const
+// ------------------------------------------------- print ------------------------------------------------------------
+void Drama::print(int shownStock) const
 {
-    std::cout << "D, " << stock << ", " << director << ", " << title << ", " << year << std::endl;
-} // end of display
+    Output::out() << "D, " << shownStock << ", " << director << ", " << title << ", " << year << std::endl;
+} // end of print
 
 // ------------------------------------------------ operator< ---------------------------------------------------------
 bool Drama::operator<(const Movie *other) const
 {
     const Drama *o = dynamic_cast<const Drama*>(other);
     if (!o) return false;
-    if (director != o->director) return director < o->director;
+    if (!StringPool::same(director, o->director)) return director < o->director;
     return title < o->title;
 } // end of operator<
 
@@ -45,7 +61,7 @@ bool Drama::operator<(const Movie *other) const
 bool Drama::operator==(const Movie *other) const
 {
     const Drama *o = dynamic_cast<const Drama*>(other);
-    return o && director == o->director && title == o->title;
+    return o && StringPool::same(director, o->director) && StringPool::same(title, o->title);
 } // end of operator==
 
 // ------------------------------------------------ getCategory -------------------------------------------------------
@@ -57,5 +73,5 @@ char Drama::getCategory() const
 // ------------------------------------------------- buildKey ---------------------------------------------------------
 std::string Drama::buildKey() const
 {
-    return director + "|" + title;
+    return std::string(director) + "|" + std::string(title);
 } // end of buildKey
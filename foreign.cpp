@@ -0,0 +1,94 @@
+// -------------------------------------------------- foreign.cpp -----------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Concrete Foreign implementation. Sorts by Director→Title; key = "Director|Title".
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "foreign.h"
+#include "movie.h"
+#include "Output.h"
+#include "StringPool.h"
+#include <iostream>   // streaming of print()
+
+// ------------------------------------------------- Foreign ----------------------------------------------------------
+Foreign::Foreign() : Movie(), language(StringPool::intern(""))
+{
+} // end of Foreign default ctor
+
+// --------------------------------------------- Foreign (overload) ---------------------------------------------------
+Foreign::Foreign(const std::string &title, int stock, const std::string &director, int year,
+                 const std::string &language)
+    : Movie(title, stock, director, year),
+      language(StringPool::intern(language))
+{
+} // end of Foreign(value) ctor
+
+// -------------------------------------------------- parse -----------------------------------------------------------
+Movie* Foreign::parse(const std::string &title, int stock, const std::string &director,
+                      const std::string &tail, std::string &error)
+{
+    // tail = "Language Year": the year is the last token, everything before it is the language
+    const size_t sp = tail.find_last_of(" \t");
+    int year = 0;
+    if (sp == std::string::npos || !parseInt(tail.substr(sp + 1), year))
+    {
+        error = "invalid foreign tail";
+        return nullptr;
+    }
+
+    const size_t e = tail.find_last_not_of(" \t", sp);
+    if (e == std::string::npos)
+    {
+        error = "missing language";
+        return nullptr;
+    }
+    return new Foreign(title, stock, director, year, tail.substr(0, e + 1));
+} // end of parse
+
+// ------------------------------------------------- ~Foreign ---------------------------------------------------------
+Foreign::~Foreign()
+{
+} // end of ~Foreign
+
+// -------------------------------------------------- print -----------------------------------------------------------
+void Foreign::print(int shownStock) const
+{
+    Output::out() << "W, " << shownStock << ", " << director << ", " << title << ", "
+                  << language << " " << year << std::endl;
+} // end of print
+
+// ------------------------------------------------ operator< ---------------------------------------------------------
+bool Foreign::operator<(const Movie *other) const
+{
+    const Foreign *o = dynamic_cast<const Foreign*>(other);
+    if (!o) return false;
+    if (!StringPool::same(director, o->director)) return director < o->director;
+    return title < o->title;
+} // end of operator<
+
+// ------------------------------------------------ operator== --------------------------------------------------------
+bool Foreign::operator==(const Movie *other) const
+{
+    const Foreign *o = dynamic_cast<const Foreign*>(other);
+    return o && StringPool::same(director, o->director) && StringPool::same(title, o->title);
+} // end of operator==
+
+// ------------------------------------------------ getCategory -------------------------------------------------------
+char Foreign::getCategory() const
+{
+    return 'W';
+} // end of getCategory
+
+// ------------------------------------------------- buildKey ---------------------------------------------------------
+std::string Foreign::buildKey() const
+{
+    return std::string(director) + "|" + std::string(title);
+} // end of buildKey
+
+// ------------------------------------------------- accessors --------------------------------------------------------
+std::string_view Foreign::getLanguage() const
+{
+    return language;
+} // end of getLanguage
@@ -0,0 +1,53 @@
+// -------------------------------------------------- foreign.h -------------------------------------------------------
+// Programmer: <Clayton McArthur>
+// Creation Date: <2026-10-19>
+// Last Modified: <2026-10-19>
+// --------------------------------------------------------------------------------------------------------------------
+// Purpose: Foreign-language movies (code 'W'); ordering by Director then Title. Key is "Director|Title".
+//          Movies line: "W, Stock, Director, Title, Language Year" (language may be several words).
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef FOREIGN_H
+#define FOREIGN_H
+
+#include "movie.h"
+#include <string>
+
+class Foreign : public Movie {
+public:
+    // ------------------------------------------------ Foreign -------------------------------------------------------
+    Foreign();
+
+    // -------------------------------------------- Foreign (overload) ------------------------------------------------
+    Foreign(const std::string &title, int stock,
+            const std::string &director, int year, const std::string &language);
+
+    // ------------------------------------------------ parse ---------------------------------------------------------
+    // Description: Build a Foreign from the loader's common fields plus the genre-specific line tail
+    //              ("Language Year").
+    // Returns    : New Foreign (caller owns), or nullptr with 'error' set to the reason.
+    static Movie* parse(const std::string &title, int stock, const std::string &director,
+                        const std::string &tail, std::string &error);
+
+    // ------------------------------------------------ ~Foreign ------------------------------------------------------
+    virtual ~Foreign() override;
+
+    // ------------------------------------------------ print ---------------------------------------------------------
+    void print(int shownStock) const override;
+
+    // --------------------------------------------- comparisons ------------------------------------------------------
+    bool operator<(const Movie *other) const override;
+    bool operator==(const Movie *other) const override;
+
+    // ------------------------------------------------ metadata ------------------------------------------------------
+    char        getCategory() const override;
+    std::string buildKey()    const override;
+
+    // ------------------------------------------------ accessors -----------------------------------------------------
+    std::string_view getLanguage() const;   // interned
+
+private:
+    std::string_view language;
+};
+
+#endif // FOREIGN_H
@@ -7,126 +7,340 @@
 //           prints inventory/history output to stdout, and validation/errors to stderr.
 // Usage   : ./movies_tester [moviesFile] [customersFile] [commandsFile] [completedLogFile]
 //           Defaults: data4movies.txt, data4customers.txt, data4commands.txt, completed_commands.txt
+//           Options (after the positional files): --checkpoint <file> [--checkpoint-every <N>]
+//           Saves a resumable checkpoint every N commands (default 1000); if <file> exists at startup the run
+//           resumes from it (see Checkpoint.h). The checkpoint is deleted when the batch completes.
+//           --history <dir> [--history-every <N>]: also keep a checkpoint every N commands (default 1000) in dir,
+//           indexed by command line number, for later "as of" queries (see TimeTravel.h).
+//           --as-of <line> [--history <dir>] [--customer <id>]: instead of running the batch, print the inventory
+//           (and the customer's loans and history) as they stood after that commands-file line.
+//           ./movies_tester --stores <manifestFile> <commandsFile> [outDir] [threads]
+//           Multi-store mode (see StoreShards.h); outDir defaults to ".", threads to hardware concurrency.
+//           ./movies_tester --scenarios <moviesFile> <customersFile> <scenarioList> [outDir] [jobs]
+//           What-if mode (see ScenarioRunner.h): one baseline load, one forked replay per scenario; outDir
+//           defaults to ".", jobs to hardware concurrency.
+//           ./movies_tester --validate <moviesFile> <customersFile> <commandsFile> [threads]
+//           Dry run (see CommandValidator.h): parse every command and check its customer/title against the loaded
+//           state without executing; prints a line-ordered problem report. Exit status 1 if any line has one.
+//           Every mode accepts --bloom-fpr <rate>: target false-positive rate of the customer-id and movie-key
+//           Bloom filters (default 0.01).
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "Inventory.h"
 #include "CustomerHashTable.h"
 #include "Customer.h"
-#include "CommandFactory.h"
+#include "CommandProcessor.h"
+#include "StoreShards.h"
+#include "ScenarioRunner.h"
+#include "CommandValidator.h"
+#include "StartupOrchestrator.h"
+#include "Checkpoint.h"
+#include "TimeTravel.h"
+#include "MemoryAccounting.h"
+#include "BloomFilter.h"
 
+#include <chrono>      // validate timings
 #include <fstream>     // file I/O
+#include <iomanip>     // timing precision
 #include <iostream>    // std::cout/std::cerr
 #include <sstream>
 #include <string>
 #include <exception>
+#include <filesystem>  // completed-log truncation on resume
+#include <vector>
 
-// ---------------------------------------------------- trim ----------------------------------------------------------
-static inline std::string trim(const std::string &s)
+// -------------------------------------------------- runStores -------------------------------------------------------
+// Description: Multi-store entry point: argv = --stores <manifest> <commands> [outDir] [threads].
+// --------------------------------------------------------------------------------------------------------------------
+static int runStores(int argc, char** argv)
 {
-    size_t b = s.find_first_not_of(" \t\r\n");
-    if (b == std::string::npos) return "";
-    size_t e = s.find_last_not_of(" \t\r\n");
-    return s.substr(b, e - b + 1);
+    if (argc < 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " --stores <manifestFile> <commandsFile> [outDir] [threads]"
+                  << std::endl;
+        return 1;
+    }
+    const std::string manifest     = argv[2];
+    const std::string commandsFile = argv[3];
+    const std::string outDir       = (argc >= 5) ? argv[4] : ".";
+    const unsigned    threads      = (argc >= 6) ? static_cast<unsigned>(std::stoul(argv[5])) : 0;
+
+    std::cerr << "[info] Stores: " << manifest
+              << " | Commands: "   << commandsFile
+              << " | Output dir: " << outDir << std::endl;
+
+    StoreShards stores;
+    if (!stores.loadManifest(manifest)) return 1;
+    if (!stores.partitionCommands(commandsFile)) return 1;
+    stores.run(outDir, threads);
+    return 0;
 }
 
-// ---------------------------------------------------- main ----------------------------------------------------------
-int main(int argc, char** argv) try
+// ------------------------------------------------- runScenarios -----------------------------------------------------
+// Description: What-if entry point: argv = --scenarios <movies> <customers> <scenarioList> [outDir] [jobs].
+// --------------------------------------------------------------------------------------------------------------------
+static int runScenarios(int argc, char** argv)
 {
-    std::string moviesFile    = "data4movies.txt";
-    std::string customersFile = "data4customers.txt";
-    std::string commandsFile  = "data4commands.txt";
-    std::string completedLog  = "completed_commands.txt";
-
-    if (argc >= 4)
+    if (argc < 5)
     {
-        moviesFile    = argv[1];
-        customersFile = argv[2];
-        commandsFile  = argv[3];
-    }
-    if (argc >= 5)
-    {
-        completedLog  = argv[4];
+        std::cerr << "Usage: " << argv[0]
+                  << " --scenarios <moviesFile> <customersFile> <scenarioList> [outDir] [jobs]" << std::endl;
+        return 1;
     }
+    const std::string moviesFile    = argv[2];
+    const std::string customersFile = argv[3];
+    const std::string scenarioList  = argv[4];
+    const std::string outDir        = (argc >= 6) ? argv[5] : ".";
+    const unsigned    jobs          = (argc >= 7) ? static_cast<unsigned>(std::stoul(argv[6])) : 0;
 
     std::cerr << "[info] Movies: "     << moviesFile
               << " | Customers: "      << customersFile
-              << " | Commands: "       << commandsFile
-              << " | Completed log: "  << completedLog << std::endl;
+              << " | Scenarios: "      << scenarioList
+              << " | Output dir: "     << outDir << std::endl;
+
+    ScenarioRunner scenarios;
+    if (!scenarios.loadList(scenarioList)) return 1;
+    if (!scenarios.loadBaseline(moviesFile, customersFile)) return 1;
+    return scenarios.run(outDir, jobs) ? 0 : 1;
+}
 
-    // Open completed-commands log (truncate).
-    std::ofstream completed(completedLog);
-    if (!completed)
+// -------------------------------------------------- runValidate -----------------------------------------------------
+// Description: Dry-run entry point: argv = --validate <movies> <customers> <commands> [threads].
+// --------------------------------------------------------------------------------------------------------------------
+static int runValidate(int argc, char** argv)
+{
+    if (argc < 5)
     {
-        std::cerr << "ERROR: cannot open completed log file for write: " << completedLog << std::endl;
+        std::cerr << "Usage: " << argv[0]
+                  << " --validate <moviesFile> <customersFile> <commandsFile> [threads]" << std::endl;
         return 1;
     }
-    completed << "# Completed (parsed & executed) commands\n";
+    const std::string moviesFile    = argv[2];
+    const std::string customersFile = argv[3];
+    const std::string commandsFile  = argv[4];
+    const unsigned    threads       = (argc >= 6) ? static_cast<unsigned>(std::stoul(argv[5])) : 0;
 
-    // Load inventory.
+    std::cerr << "[info] Movies: "     << moviesFile
+              << " | Customers: "      << customersFile
+              << " | Validating: "     << commandsFile << std::endl;
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point loadStart = Clock::now();
     Inventory inventory;
     inventory.loadMovies(moviesFile);
-
-    // Load customers.
     CustomerHashTable customers;
+    if (!customers.loadCustomers(customersFile)) return 1;
+
+    const Clock::time_point checkStart = Clock::now();
+    CommandValidator validator(inventory, customers);
+    if (!validator.validate(commandsFile, threads)) return 1;
+    const Clock::time_point checkEnd = Clock::now();
+
+    validator.report(std::cout);
+    std::cerr << std::fixed << std::setprecision(2)
+              << "[info] Validate: load "
+              << std::chrono::duration<double, std::milli>(checkStart - loadStart).count() << " ms | check "
+              << std::chrono::duration<double, std::milli>(checkEnd - checkStart).count() << " ms on "
+              << validator.getRangeCount() << " thread(s)" << std::endl;
+    return validator.getProblemCount() == 0 ? 0 : 1;
+}
+
+// ---------------------------------------------------- main ----------------------------------------------------------
+int main(int argc, char** argv) try
+{
+    // --bloom-fpr <rate> and --reload-lag <n> apply to every mode; strip them before the positional parsing below.
+    for (int i = 1; i + 1 < argc;)
     {
-        std::ifstream fin(customersFile);
-        if (!fin)
+        const std::string opt = argv[i];
+        if (opt == "--bloom-fpr")
+        {
+            BloomFilter::setDefaultRate(std::stod(argv[i + 1]));
+        }
+        else if (opt == "--reload-lag")
         {
-            std::cerr << "ERROR: cannot open customers file: " << customersFile << std::endl;
-            return 1;
+            const long long lag = std::stoll(argv[i + 1]);
+            Inventory::setReloadLag(lag > 0 ? static_cast<uint64_t>(lag) : 0);
         }
-        int id; std::string last, first;
-        while (fin >> id >> last >> first)
+        else
         {
-            customers.addCustomer(id, new Customer(id, first, last));
+            ++i;
+            continue;
         }
+        for (int j = i; j + 2 <= argc; ++j) argv[j] = argv[j + 2];
+        argc -= 2;
     }
 
-    // Process commands (line by line).
-    std::ifstream fin(commandsFile);
-    if (!fin)
+    if (argc >= 2 && std::string(argv[1]) == "--stores")
     {
-        std::cerr << "ERROR: cannot open commands file: " << commandsFile << std::endl;
-        return 1;
+        return runStores(argc, argv);
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--scenarios")
+    {
+        return runScenarios(argc, argv);
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--validate")
+    {
+        return runValidate(argc, argv);
     }
 
-    std::string line;
-    int lineNo = 0, executed = 0, skipped = 0;
+    std::string moviesFile     = "data4movies.txt";
+    std::string customersFile  = "data4customers.txt";
+    std::string commandsFile   = "data4commands.txt";
+    std::string completedLog   = "completed_commands.txt";
+    std::string checkpointFile;
+    int         checkpointEvery = 1000;
+    std::string historyDir;
+    int         historyEvery    = 1000;
+    TimeTravel::Query asOf;
 
-    while (std::getline(fin, line))
+    // Split options from positional arguments.
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i)
     {
-        ++lineNo;
-        if (trim(line).empty()) continue;
-
-        Command *cmd = CommandFactory::createCommand(line);
-        if (!cmd)
+        const std::string arg = argv[i];
+        if (arg == "--checkpoint" && i + 1 < argc)
         {
-            ++skipped;
-            continue;
+            checkpointFile = argv[++i];
         }
-
-        try
+        else if (arg == "--checkpoint-every" && i + 1 < argc)
+        {
+            checkpointEvery = std::stoi(argv[++i]);
+            if (checkpointEvery <= 0) checkpointEvery = 1;
+        }
+        else if (arg == "--history" && i + 1 < argc)
+        {
+            historyDir = argv[++i];
+        }
+        else if (arg == "--history-every" && i + 1 < argc)
         {
-            cmd->execute(inventory, customers);
-            completed << line << "\n";   // record only parsed+executed commands
-            ++executed;
+            historyEvery = std::stoi(argv[++i]);
+            if (historyEvery <= 0) historyEvery = 1;
         }
-        catch (const std::exception &e)
+        else if (arg == "--as-of" && i + 1 < argc)
         {
-            std::cerr << "ERROR: [command line " << lineNo << "] exception: " << e.what()
-                      << " while executing -> " << line << std::endl;
+            asOf.asOf = std::stoi(argv[++i]);
+            if (asOf.asOf <= 0) asOf.asOf = 1;
         }
-        catch (...)
+        else if (arg == "--customer" && i + 1 < argc)
         {
-            std::cerr << "ERROR: [command line " << lineNo << "] unknown exception while executing -> "
-                      << line << std::endl;
+            asOf.forCustomer = true;
+            asOf.customerId  = std::stoi(argv[++i]);
         }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
 
-        delete cmd;
+    if (args.size() >= 3)
+    {
+        moviesFile    = args[0];
+        customersFile = args[1];
+        commandsFile  = args[2];
+    }
+    if (args.size() >= 4)
+    {
+        completedLog  = args[3];
+    }
+
+    if (asOf.asOf > 0)
+    {
+        asOf.moviesFile    = moviesFile;
+        asOf.customersFile = customersFile;
+        asOf.commandsFile  = commandsFile;
+        asOf.historyDir    = historyDir;
+        return TimeTravel::query(asOf);
+    }
+
+    Checkpoint::State resume;
+    const bool resuming = !checkpointFile.empty() && Checkpoint::read(checkpointFile, resume);
+
+    std::cerr << "[info] Movies: "     << moviesFile
+              << " | Customers: "      << customersFile
+              << " | Commands: "       << commandsFile
+              << " | Completed log: "  << completedLog << std::endl;
+
+    // Open completed-commands log: truncate, or on resume cut it back to the checkpointed length and append.
+    std::ofstream completed;
+    if (resuming)
+    {
+        std::error_code ec;
+        std::filesystem::resize_file(completedLog, static_cast<uintmax_t>(resume.completedBytes), ec);
+        completed.open(completedLog, std::ios::app);
+        std::cerr << "[info] Resuming from checkpoint " << checkpointFile << " at line " << resume.lineNo
+                  << std::endl;
+    }
+    else
+    {
+        completed.open(completedLog);
+        completed << "# Completed (parsed & executed) commands\n";
     }
+    if (!completed || (resuming && completed.tellp() != resume.completedBytes))
+    {
+        std::cerr << "ERROR: cannot open completed log file for write: " << completedLog << std::endl;
+        return 1;
+    }
+
+    // Load inventory and customers and prefetch commands, in parallel.
+    Inventory inventory;
+    CustomerHashTable customers;
+    StartupOrchestrator startup(inventory, customers);
+    if (!startup.load(moviesFile, customersFile, commandsFile, resuming ? &resume : nullptr))
+    {
+        return 1;
+    }
+    std::cerr << std::fixed << std::setprecision(2)
+              << "[info] Startup: movies " << startup.getMoviesMs() << " ms | customers " << startup.getCustomersMs()
+              << " ms | commands " << startup.getCommandsMs() << " ms (" << startup.getPrefetched()
+              << " prefetched) | time to first command " << startup.getStartupMs() << " ms" << std::endl;
+
+    // Process commands (line by line).
+    CommandProcessor processor(inventory, customers, completed);
+    if (resuming) processor.resumeCounts(resume.executed, resume.skipped);
+
+    TimeTravel history;
+    if (!historyDir.empty() && !history.start(historyDir)) historyDir.clear();
+
+    int sinceCheckpoint = 0;
+    int sinceHistory    = 0;
+    auto checkpoint = [&](std::streamoff offset, int lineNo)
+    {
+        const bool resumePoint  = !checkpointFile.empty() && ++sinceCheckpoint >= checkpointEvery;
+        const bool historyPoint = !historyDir.empty() && ++sinceHistory >= historyEvery;
+        if (!resumePoint && !historyPoint) return;
+
+        completed.flush();
+        Checkpoint::State position;
+        position.offset         = offset;
+        position.lineNo         = lineNo;
+        position.completedBytes = completed.tellp();
+        position.executed       = processor.getExecuted();
+        position.skipped        = processor.getSkipped();
+        position.commandSeq     = inventory.getCommandSeq();
+        if (resumePoint)
+        {
+            sinceCheckpoint = 0;
+            Checkpoint::save(checkpointFile, position, inventory, customers);
+        }
+        if (historyPoint)
+        {
+            sinceHistory = 0;
+            history.record(position, inventory, customers);
+        }
+    };
+    startup.replay(processor, checkpoint);
+    inventory.applyReload(true);   // a reload still parsing at end of input is merged before the summary
+
+    std::cerr << "[info] Commands executed: " << processor.getExecuted()
+              << " | skipped/malformed: "    << processor.getSkipped() << std::endl;
+    std::cerr << "[info] Copies: " << inventory.getShelfCopies() << " on shelf + "
+              << inventory.getCheckedOutCopies() << " checked out = " << inventory.getTotalCopies()
+              << (inventory.checkInvariant() ? " (ok)" : " (INVARIANT VIOLATED)") << std::endl;
+
+    MemoryAccounting::report(std::cerr, "[info] Memory: ", static_cast<size_t>(inventory.getTitleCount()),
+                             customers.size());
 
-    std::cerr << "[info] Commands executed: " << executed
-              << " | skipped/malformed: "    << skipped << std::endl;
+    if (!checkpointFile.empty()) Checkpoint::remove(checkpointFile);
 
     return 0;
 }
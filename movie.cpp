@@ -7,25 +7,30 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include "movie.h"
+#include "StringPool.h"
+#include "MemoryAccounting.h"
 #include <iostream>
+#include <limits>     // adjustStock overflow check
 #include <string>
 
 // ------------------------------------------------ Movie -------------------------------------------------------------
 Movie::Movie()
 {
-    this->title    = "";
+    this->title    = StringPool::intern("");
     this->stock    = 0;
-    this->director = "";
+    this->director = StringPool::intern("");
     this->year     = 0;
+    this->slot     = -1;
 } // end of Movie default ctor
 
 // --------------------------------------------- Movie (overload) ----------------------------------------------------
 Movie::Movie(const std::string &title, int stock, const std::string &director, int year)
 {
-    this->title    = title;
+    this->title    = StringPool::intern(title);
     this->stock    = stock;
-    this->director = director;
+    this->director = StringPool::intern(director);
     this->year     = year;
+    this->slot     = -1;
 } // end of Movie(value) ctor
 
 // ------------------------------------------------ ~Movie ------------------------------------------------------------
@@ -33,6 +38,26 @@ Movie::~Movie()
 {
 } // end of ~Movie
 
+// ------------------------------------------ operator new/delete ----------------------------------------------------
+void* Movie::operator new(size_t size)
+{
+    void *p = ::operator new(size);
+    MemoryAccounting::add(MemCategory::MOVIES, size);
+    return p;
+}
+
+void Movie::operator delete(void *p, size_t size)
+{
+    MemoryAccounting::sub(MemCategory::MOVIES, size);
+    ::operator delete(p);
+}
+
+// ------------------------------------------------- display ---------------------------------------------------------
+void Movie::display() const
+{
+    print(stock);
+} // end of display
+
 // ---------------------------------------------- decreaseStock ------------------------------------------------------
 bool Movie::decreaseStock()
 {
@@ -50,8 +75,17 @@ void Movie::increaseStock()
     stock += 1;
 } // end of increaseStock
 
+// ----------------------------------------------- adjustStock -------------------------------------------------------
+bool Movie::adjustStock(int delta)
+{
+    const long long adjusted = static_cast<long long>(stock) + delta;
+    if (adjusted < 0 || adjusted > std::numeric_limits<int>::max()) return false;
+    stock = static_cast<int>(adjusted);
+    return true;
+} // end of adjustStock
+
 // ------------------------------------------------ accessors --------------------------------------------------------
-std::string Movie::getTitle() const
+std::string_view Movie::getTitle() const
 {
     return this->title;
 } // end of getTitle
@@ -61,7 +95,7 @@ int Movie::getYear() const
     return this->year;
 } // end of getYear
 
-std::string Movie::getDirector() const
+std::string_view Movie::getDirector() const
 {
     return this->director;
 } // end of getDirector
@@ -71,6 +105,38 @@ int Movie::getStock() const
     return this->stock;
 } // end of getStock
 
+int Movie::getSlot() const
+{
+    return this->slot;
+} // end of getSlot
+
+void Movie::setSlot(int slot)
+{
+    this->slot = slot;
+} // end of setSlot
+
+// ------------------------------------------------- parseInt --------------------------------------------------------
+bool Movie::parseInt(const std::string &s, int &out)
+{
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return false;
+    size_t e = s.find_last_not_of(" \t\r\n");
+    const std::string t = s.substr(b, e - b + 1);
+
+    try
+    {
+        size_t idx = 0;
+        int v = std::stoi(t, &idx);
+        if (idx != t.size()) return false;
+        out = v;
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+} // end of parseInt
+
 // ---------------------------------------------- operator<< ---------------------------------------------------------
 // Calls the virtual display() so each subclass determines its printed format.
 std::ostream &operator<<(std::ostream &os, const Movie &movie)
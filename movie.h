@@ -3,8 +3,9 @@
 // Creation Date: <2025-08-15>
 // Last Modified: <2025-08-24>
 // --------------------------------------------------------------------------------------------------------------------
-// Purpose: Abstract base class for all Movie types (Comedy, Drama, Classics). Holds common fields (title, stock,
-//          director, year) and defines the polymorphic interface for display, comparison, category, and key building.
+// Purpose: Abstract base class for all Movie types (Comedy, Drama, Classics, Documentary, Foreign). Holds common
+//          fields (title, stock, director, year) and defines the polymorphic interface for display, comparison,
+//          category, and key building.
 // Notes :  - Virtual destructor for safe polymorphic deletion.
 //          - No global variables; only class members (per course standards).
 //          - operator<< is declared; implementation calls display() in movie.cpp.
@@ -13,8 +14,10 @@
 #ifndef MOVIE_H
 #define MOVIE_H
 
+#include <cstddef>    // size_t for operator new/delete
 #include <iostream>   // std::ostream for operator<<
-#include <string>     // std::string for titles, directors, keys
+#include <string>     // std::string keys
+#include <string_view> // interned title/director handles (see StringPool.h)
 
 class Movie {
 public:
@@ -44,10 +47,22 @@ public:
     // ----------------------------------------------------------------------------------------------------------------
     virtual void increaseStock();
 
+    // ------------------------------------------ adjustStock ---------------------------------------------------------
+    // Description: Add 'delta' copies in one step (negative removes). If stock would drop below zero or overflow,
+    //              leave it unchanged and return false.
+    // ----------------------------------------------------------------------------------------------------------------
+    virtual bool adjustStock(int delta);
+
     // --------------------------------------------- display ----------------------------------------------------------
-    // Description: Print a concrete Movie’s details. Must be implemented by derived types.
+    // Description: Print this Movie’s details with its live stock (delegates to print()).
+    // ----------------------------------------------------------------------------------------------------------------
+    virtual void display() const;
+
+    // ---------------------------------------------- print -----------------------------------------------------------
+    // Description: Print a concrete Movie’s details showing 'shownStock' instead of the live stock, so inventory
+    //              snapshots can render stock as of the moment they were taken. Must be implemented by derived types.
     // ----------------------------------------------------------------------------------------------------------------
-    virtual void display() const = 0;
+    virtual void print(int shownStock) const = 0;
 
     // -------------------------------------- comparison / identity ---------------------------------------------------
     // Description: Polymorphic comparisons required by inventory sorting and equality checks.
@@ -56,22 +71,45 @@ public:
     virtual bool operator==(const Movie *other) const = 0;
 
     // -------------------------------------------- metadata ----------------------------------------------------------
-    // Description: Category character ('F','D','C') and canonical inventory key for lookups/merges.
+    // Description: Category character ('F','D','C','N','W') and canonical inventory key for lookups/merges.
     // ----------------------------------------------------------------------------------------------------------------
     virtual char        getCategory() const = 0;
     virtual std::string buildKey()    const = 0;
 
     // -------------------------------------------- accessors ---------------------------------------------------------
-    std::string getTitle()    const;
-    int         getYear()     const;
-    std::string getDirector() const;
-    int         getStock()    const;
+    // Description: Title and director are interned in the loading inventory's StringPool; the views stay valid as
+    //              long as that inventory.
+    // ----------------------------------------------------------------------------------------------------------------
+    std::string_view getTitle()    const;
+    int              getYear()     const;
+    std::string_view getDirector() const;
+    int              getStock()    const;
+
+    // ----------------------------------------- inventory slot -------------------------------------------------------
+    // Description: Dense index assigned by Inventory on insertion (-1 until stocked); addresses the movie's entry
+    //              in the inventory's versioned stock table.
+    // ----------------------------------------------------------------------------------------------------------------
+    int  getSlot() const;
+    void setSlot(int slot);
+
+    // ------------------------------------------ operator new/delete -------------------------------------------------
+    // Description: Attribute every Movie-derived object's bytes to MemCategory::MOVIES (see MemoryAccounting.h); the
+    //              virtual destructor passes the dynamic size to the sized delete.
+    // ----------------------------------------------------------------------------------------------------------------
+    static void* operator new(size_t size);
+    static void  operator delete(void *p, size_t size);
 
 protected:
-    std::string title;
-    int         stock;
-    std::string director;
-    int         year;
+    // -------------------------------------------- parseInt ----------------------------------------------------------
+    // Description: Strict integer parse (surrounding whitespace allowed) for genre line-tail parsers.
+    // ----------------------------------------------------------------------------------------------------------------
+    static bool parseInt(const std::string &s, int &out);
+
+    std::string_view title;      // interned
+    int              stock;
+    std::string_view director;   // interned
+    int              year;
+    int              slot;
 };
 
 // ------------------------------------------- operator<< -------------------------------------------------------------